@@ -87,6 +87,9 @@ namespace dsp {
 
     const Input* get_loader() const { return input; }
 
+    //! Wall-clock time at which the first sample arrived (see Input::get_clock)
+    double get_arrival_time () const { return arrival_time; }
+
     void set_memory (Memory*);
 
     Memory* get_memory () { return memory; }
@@ -121,6 +124,9 @@ namespace dsp {
     //! The Input instance to last set input_sample
     Input* input;
 
+    //! Wall-clock time at which the first sample arrived
+    double arrival_time;
+
     //! The memory manager
     Reference::To<Memory> memory;
 
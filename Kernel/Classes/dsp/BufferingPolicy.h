@@ -40,6 +40,9 @@ namespace dsp {
     //! Set the minimum number of samples that can be processed
     virtual void set_minimum_samples (uint64_t minimum_samples) = 0;
 
+    //! Return the number of bytes of memory used to buffer data
+    virtual uint64_t get_nbytes () const { return 0; }
+
     //! Returns the name
     std::string get_name() { return name; }
 
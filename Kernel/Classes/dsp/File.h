@@ -39,6 +39,7 @@ namespace dsp {
     friend class Multiplex;
     friend class HoleyFile;
     friend class RingBuffer;
+    friend class ReadAhead;
     
   public:
     
@@ -0,0 +1,56 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_HalfPrecision_h
+#define __dsp_HalfPrecision_h
+
+#include <string>
+#include <inttypes.h>
+
+namespace dsp {
+
+  //! Conversion between single and 16-bit floating point storage
+  /*! Data that originate from 2- to 8-bit samples retain far more
+    precision than the digitizer provided when stored using 16 bits.
+    Conversion to and from IEEE 754 half precision uses the F16C
+    instructions when the compiler targets them. */
+  namespace HalfPrecision {
+
+    //! Storage formats
+    enum Format
+    {
+      //! 32-bit float (no conversion)
+      None,
+      //! IEEE 754 half precision: 5-bit exponent, 10-bit mantissa
+      Float16,
+      //! Truncated single precision: 8-bit exponent, 7-bit mantissa
+      BFloat16
+    };
+
+    //! Convert n floats to the specified format, rounding to nearest even
+    void pack (uint16_t* to, const float* from, uint64_t n, Format);
+
+    //! Convert n values in the specified format to floats
+    void unpack (float* to, const uint16_t* from, uint64_t n, Format);
+
+    //! Return the largest finite value in the specified format
+    float maximum (Format);
+
+    //! Return true if n floats can be converted without overflow
+    bool in_range (const float* from, uint64_t n, Format);
+
+    //! Parse the name of a format ("f32", "f16", or "bf16")
+    Format parse (const std::string& name);
+
+    //! Return the name of a format
+    std::string name (Format);
+  }
+
+}
+
+#endif
@@ -85,13 +85,30 @@ namespace dsp {
     // (should not normally need to be used)
     virtual void set_output (BitSeries* output);
 
+    //! Get the BitSeries into which data are loaded
+    const BitSeries* get_output () const { return output; }
+
     //! Set the maximum RAM usage constraint in set_block_size
     void set_maximum_RAM (uint64_t);
+    uint64_t get_maximum_RAM () const { return maximum_RAM; }
     //! Set the minimum RAM usage constraint in set_block_size
     void set_minimum_RAM (uint64_t);
+    //! Set the maximum number of time samples in set_block_size
+    /*! Limits the latency of real-time processing; overrides the RAM
+      constraints but not the minimum number of samples required */
+    void set_maximum_samples (uint64_t ndat) { maximum_samples = ndat; }
     //! Set the number of copies of data constraint in set_block_size
     void set_copies (unsigned);
 
+    //! Set the memory required by all operations in set_block_size
+    /*! Overrides the number of copies of data */
+    void set_footprint (const Footprint&);
+    //! Get the memory that does not depend on block size
+    uint64_t get_fixed_RAM () const { return fixed_RAM; }
+
+    //! Add the raw and unpacked data
+    void add_footprint (Footprint&) const;
+
     //! Set custom post load operation
     void set_post_load_operation (Operation * op);
 
@@ -135,8 +152,14 @@ namespace dsp {
 
     uint64_t maximum_RAM;
     uint64_t minimum_RAM;
+    uint64_t maximum_samples;
     unsigned copies;
     unsigned filterbank_resolution;
+
+    //! Memory that does not depend on block size
+    uint64_t fixed_RAM;
+    //! Memory per time sample of the block; zero if set_footprint not called
+    double sample_RAM;
   };
 
 }
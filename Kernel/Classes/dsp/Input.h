@@ -140,6 +140,24 @@ namespace dsp {
     //! Input derived types may specify a prefix to be added to output files
     virtual std::string get_prefix () const;
 
+    //! Set the time to wait for a full block before loading part of it
+    /*! If non-zero, sources of real-time data (e.g. ring buffers) may
+      return fewer than block_size time samples when the block is not
+      complete within this many seconds of the arrival of its first
+      sample.  Other sources ignore the deadline. */
+    void set_deadline (double seconds) { deadline = seconds; }
+    double get_deadline () const { return deadline; }
+
+    //! Set the minimum number of time samples loaded after the deadline
+    void set_minimum_partial (uint64_t ndat) { minimum_partial = ndat; }
+    uint64_t get_minimum_partial () const { return minimum_partial; }
+
+    //! Return true if the last block was cut short by the deadline
+    bool get_partial () const { return partial; }
+
+    //! Return the monotonic wall-clock time in seconds
+    static double get_clock ();
+
   protected:
 
     //! Set the 'end_of_data' flag in dsp::Seekable
@@ -176,6 +194,21 @@ namespace dsp {
     //! If not "" then the source of the output gets changed to this after loading [""]
     std::string real_source;
 
+    //! Seconds to wait for a full block before loading part of it
+    double deadline;
+
+    //! Minimum number of time samples loaded after the deadline
+    uint64_t minimum_partial;
+
+    //! Set by load_data when the block was cut short by the deadline
+    bool partial;
+
+    //! Wall-clock time at which the first sample of the block arrived
+    double arrival_time;
+
+    //! Set the arrival time of the first sample of the block (default: now)
+    void set_arrival_time (double seconds = 0.0);
+
   private:
 
     //! Requested number of time samples to be read during load
@@ -12,6 +12,9 @@
 #include "dsp/BufferingPolicy.h"
 #include "dsp/TimeSeries.h"
 #include "dsp/Transformation.h"
+#include "dsp/HalfPrecision.h"
+
+#include <vector>
 
 namespace dsp {
 
@@ -22,10 +25,20 @@ namespace dsp {
   {
 
   public:
+
+    //! Default storage format of the buffer
+    static HalfPrecision::Format default_storage;
     
     //! Default constructor
     InputBuffering (HasInput<TimeSeries>* target = 0);
 
+    //! Set the storage format of the buffer
+    /*! 16-bit formats are used only for unweighted, undetected voltages
+      in host memory; a reserve with any value beyond the range of the
+      format is kept as float */
+    void set_storage (HalfPrecision::Format format) { storage = format; }
+    HalfPrecision::Format get_storage () const { return storage; }
+
     //! Set the target with input TimeSeries to be buffered
     void set_target (HasInput<TimeSeries>* input);
     
@@ -41,6 +54,9 @@ namespace dsp {
     //! Set the minimum number of samples that can be processed
     void set_minimum_samples (uint64_t samples);
 
+    //! Return the number of bytes in the reserve and the buffer
+    uint64_t get_nbytes () const;
+
     //! Get the next contiguous sample following the current buffer
     int64_t get_next_contiguous () const;
 
@@ -64,6 +80,33 @@ namespace dsp {
     //! The reserve manager
     Reference::To<Reserve> reserve;
 
+    //! The storage format of the buffer
+    HalfPrecision::Format storage;
+
+    //! Buffered data in 16-bit storage
+    std::vector<uint16_t> packed;
+
+    //! Number of time samples in packed
+    uint64_t packed_ndat;
+
+    //! Offset between (channel, polarization) parts of packed
+    uint64_t packed_stride;
+
+    //! Input sample of the first time sample in packed
+    int64_t packed_input_sample;
+
+    //! True when the buffered data are stored in packed
+    bool use_packed;
+
+    //! Return true if the input can be buffered in 16-bit storage
+    bool can_pack (const TimeSeries*) const;
+
+    //! Copy remaining data from input to packed, if within range
+    bool pack (const TimeSeries* input, uint64_t ndat);
+
+    //! Prepend packed data to the input
+    void unpack (TimeSeries* input);
+
   };
 
 }
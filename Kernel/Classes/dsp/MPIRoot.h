@@ -13,6 +13,7 @@
 
 #define ACTIVATE_MPI 1
 #include "dsp/Input.h"
+#include "dsp/BitSeries.h"
 
 
 namespace dsp {
@@ -49,6 +50,16 @@ namespace dsp {
     //! Setting the block_size requires resizing the buffer
     void set_block_size (uint64_t _size);
 
+    //! Get the number of blocks that may be in flight to each node
+    unsigned get_pipeline_depth () const { return pipeline_depth; }
+    //! Set the number of blocks that may be in flight to each node
+    /*! When depth is zero (the default), each block is copied into a
+      single buffer with MPI_Pack and the root waits for each send to
+      complete.  Otherwise, each block is sent from its own BitSeries
+      using a derived datatype and up to depth blocks are requested by
+      each node before the first of them is consumed. */
+    void set_pipeline_depth (unsigned depth);
+
     //! Prepare for sending or receiving from root node
     void prepare ();
 
@@ -92,6 +103,77 @@ namespace dsp {
     //! resize the pack_buf
     void size_pack_buffer ();
 
+    //! Number of blocks in flight to each node
+    unsigned pipeline_depth;
+
+    //! Header sent with each block
+    struct Header
+    {
+      int64_t start_sample;
+      uint64_t request_ndat;
+      unsigned request_offset;
+    };
+
+    //! A block in flight when pipeline_depth > 0
+    class Slot
+    {
+    public:
+      //! header of the block
+      Header header;
+      //! data loaded by the root node
+      Reference::To<BitSeries> data;
+      //! data received by the other nodes
+      std::vector<char> buffer;
+      //! datatype describing header and buffer on receive
+      MPI_Datatype type;
+      //! number of bytes received, or -1 if the receive is pending
+      int received;
+      //! the ready flag sent with this slot's request
+      int ready;
+    };
+
+    //! Blocks in flight
+    std::vector<Slot> slots;
+
+    //! Send or receive request of each slot
+    std::vector<MPI_Request> slot_requests;
+
+    //! Ready-for-data request of each slot (other nodes only)
+    std::vector<MPI_Request> slot_ready_requests;
+
+    //! Oldest slot with an outstanding receive
+    unsigned next_slot;
+
+    //! Number of end-of-data messages sent to each node
+    vector<unsigned> eod_count;
+
+    //! Return a datatype describing header and nbytes at data
+    MPI_Datatype block_type (Header& header, void* data, int nbytes);
+
+    //! Allocate the slots
+    void prepare_slots ();
+
+    //! Free the datatypes of the slots
+    void free_slots ();
+
+    //! Return the index of a slot with no pending send
+    unsigned free_slot ();
+
+    //! Send the block in the specified slot (end of data if null data)
+    void send_slot (unsigned islot, BitSeries* data, int dest);
+
+    //! Post the receive and ready-for-data requests of the specified slot
+    void post_slot (unsigned islot);
+
+    //! Wait for the receive of the oldest slot to complete
+    Slot& receive_slot ();
+
+    //! Serve the data from Input with pipeline_depth > 0
+    void serve_pipelined (BitSeries* bitseries);
+
+    //! Load the next block with pipeline_depth > 0
+    void load_pipelined (BitSeries* data);
+
     //! Communicator in which data will be sent and received
     MPI_Comm comm;
 
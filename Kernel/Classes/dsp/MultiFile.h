@@ -16,6 +16,7 @@
 #define __MultiFile_h
 
 #include "dsp/File.h"
+#include "dsp/ReadAhead.h"
 
 namespace dsp {
 
@@ -77,6 +78,14 @@ namespace dsp {
     //! Add any relevant extensions (calls loader's add_extensions())
     void add_extensions (Extensions *ext);
 
+    //! Read each file in a separate thread, staging up to nbyte bytes
+    /*! When nbyte is zero (the default), files are read in the calling
+      thread.  Should be called before any data are loaded. */
+    void set_read_ahead (uint64_t nbyte);
+
+    //! Get the number of bytes staged by each reader thread
+    uint64_t get_read_ahead () const { return read_ahead; }
+
   protected:
     
     //! Open the ASCII file of filenames
@@ -103,6 +112,21 @@ namespace dsp {
     //! Ensure that files are contiguous
     void ensure_contiguity ();
 
+    //! Load bytes from the specified file (via its ReadAhead, if enabled)
+    int64_t load_from (unsigned index, unsigned char* buffer, uint64_t bytes);
+
+    //! Start reading ahead from the specified file
+    void prefetch (unsigned index);
+
+    //! Stop reading ahead from all files
+    void stop_readers ();
+
+    //! Number of bytes staged by each ReadAhead (zero when disabled)
+    uint64_t read_ahead;
+
+    //! The ReadAhead of each file
+    std::vector< Reference::To<ReadAhead> > readers;
+
   private:
 
     //! Test for contiguity
@@ -117,6 +141,9 @@ namespace dsp {
     //! Set the loader to the specified File
     void set_loader (unsigned index);
 
+    //! Return the ReadAhead of the specified file
+    ReadAhead* get_reader (unsigned index);
+
   };
 
 }
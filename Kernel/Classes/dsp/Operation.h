@@ -27,6 +27,7 @@ namespace dsp {
   
   class Scratch;
   class Extensions;
+  class Observation;
 
   //! Defines the interface by which operations are performed on data
   /*! This pure virtual base class defines the manner in which various
@@ -89,6 +90,13 @@ namespace dsp {
     //! Reset accumulated results to intial values
     virtual void reset ();
 
+    //! Memory required by one or more operations
+    class Footprint;
+
+    //! Add the memory required by this operation
+    /*! Called after prepare; used to choose the block size */
+    virtual void add_footprint (Footprint&) const;
+
     //! Return the unique name of this operation
     std::string get_name() const { return name; }
 
@@ -157,6 +165,45 @@ namespace dsp {
     bool prepared;
 
   };
+
+  //! Memory required by one or more operations
+  /*! Memory is divided into that which is proportional to the number of
+    time samples in each block read from the Input, and that which is
+    not (e.g. FFT plans, profiles, buffering reserves). */
+  class Operation::Footprint
+  {
+  public:
+
+    //! Construct with the Observation that describes the input block
+    Footprint (const Observation* input);
+
+    //! Add the memory required by data that span the input block
+    void add_block (const Observation* data);
+
+    //! Add memory that does not depend on the block size
+    void add_fixed (uint64_t bytes) { fixed_bytes += bytes; }
+
+    //! Add memory per time sample of the input block
+    void add_per_sample (double bytes) { bytes_per_sample += bytes; }
+
+    //! Get the memory that does not depend on the block size
+    uint64_t get_fixed () const { return fixed_bytes; }
+
+    //! Get the memory per time sample of the input block
+    double get_per_sample () const { return bytes_per_sample; }
+
+    //! Get the total memory required for the given block size
+    uint64_t get_bytes (uint64_t block_size) const;
+
+    //! Get the Observation that describes the input block
+    const Observation* get_input () const { return input; }
+
+  protected:
+
+    const Observation* input;
+    uint64_t fixed_bytes;
+    double bytes_per_sample;
+  };
   
 }
 
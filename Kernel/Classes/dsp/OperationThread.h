@@ -52,6 +52,9 @@ namespace dsp
     //! Calls the reset method of each Operation
     void reset ();
 
+    //! Calls the add_footprint method of each Operation
+    void add_footprint (Footprint&) const;
+
     //! Use this Operation to wait for completion of the operation thread
     class Wait;
 
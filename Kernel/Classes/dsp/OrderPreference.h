@@ -0,0 +1,40 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_OrderPreference_h
+#define __dsp_OrderPreference_h
+
+#include "dsp/TimeSeries.h"
+
+namespace dsp {
+
+  //! Declares the cost of operating on a TimeSeries in each order
+  /*! Operations that inherit this interface may be given their input
+    in either order; SingleThread::plan_order uses the declared costs to
+    decide where (if anywhere) the data should be transposed. */
+  class OrderPreference
+  {
+  public:
+
+    //! Destructor
+    virtual ~OrderPreference () {}
+
+    //! Return the cost of operating on data in the specified order
+    /*! The cost is in units of the time taken to copy the input data
+      once (e.g. with memcpy), as measured for each loop on blocks of 32
+      MB with 256 to 4096 channels.  Operations that stream through the
+      data in either order (Rescale, PScrunch, FScrunch and TScrunch)
+      were measured at 0.4 to 1.9 copies, with no order consistently
+      cheaper, and declare 1.0 for both.  A negative cost indicates that
+      the order is not supported. */
+    virtual double get_order_cost (TimeSeries::Order) const = 0;
+  };
+
+}
+
+#endif // !defined(__dsp_OrderPreference_h)
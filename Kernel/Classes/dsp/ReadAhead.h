@@ -0,0 +1,95 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_ReadAhead_h
+#define __dsp_ReadAhead_h
+
+#include "dsp/File.h"
+#include "Error.h"
+
+#include <vector>
+#include <pthread.h>
+
+class ThreadContext;
+
+namespace dsp {
+
+  //! Reads ahead from a File in a separate thread
+  /*! The I/O thread opens the File (if it is closed) and loads
+    consecutive chunks of data into a ring of staging memory, which the
+    calling thread drains with read.  MultiFile and Multiplex run one
+    ReadAhead per file, so that independent files (e.g. on separate
+    disks) are read concurrently and the next file is opened before the
+    end of the current file is reached. */
+  class ReadAhead : public Reference::Able
+  {
+  public:
+
+    //! Construct with the File and the size of the staging memory in bytes
+    ReadAhead (File* file, uint64_t nbyte);
+
+    //! Destructor stops the I/O thread
+    ~ReadAhead ();
+
+    //! Start the I/O thread
+    void start ();
+
+    //! Stop the I/O thread (discards any staged data)
+    void stop ();
+
+    //! Copy up to nbyte bytes, waiting until they are staged or end of data
+    int64_t read (unsigned char* buffer, uint64_t nbyte);
+
+    //! Return true if the I/O thread opened the File
+    bool get_opened () const { return opened; }
+
+  protected:
+
+    //! The I/O thread
+    static void* reader_thread (void*);
+    void reader ();
+
+    //! The File from which data are read
+    Reference::To<File> file;
+
+    //! The ring of staging memory
+    std::vector<unsigned char> staging;
+
+    //! The number of bytes loaded from the File in each call to load_bytes
+    uint64_t chunk;
+
+    //! The offset of the first staged byte
+    uint64_t head;
+
+    //! The number of staged bytes
+    uint64_t count;
+
+    //! The I/O thread opened the File
+    bool opened;
+
+    //! The I/O thread reached the end of the File
+    bool end_of_data;
+
+    //! The I/O thread should return
+    bool quit;
+
+    //! The I/O thread has been started
+    bool running;
+
+    //! An exception was thrown in the I/O thread
+    bool failed;
+    Error error;
+
+    //! Coordinates the calling thread and the I/O thread
+    ThreadContext* context;
+    pthread_t id;
+  };
+
+}
+
+#endif // !defined(__dsp_ReadAhead_h)
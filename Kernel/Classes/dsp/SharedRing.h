@@ -0,0 +1,154 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_SharedRing_h
+#define __dsp_SharedRing_h
+
+#include "ReferenceAble.h"
+
+#include <sys/types.h>
+#include <sys/ipc.h>
+#include <inttypes.h>
+
+namespace dsp {
+
+  //! Ring of fixed-size blocks in shared memory with one writer and many readers
+  /*! The segment is identified by a System V IPC key, as are the psrdada
+    ring buffers.  Every attached reader sees every block written after
+    it attaches; the writer blocks until all active readers have released
+    the slot that it is about to overwrite.  Readers only ever have
+    read-only access to the data.  The mutex is robust: a process that
+    dies while holding it releases its reader slot (or, if it was the
+    writer, ends the data) when the mutex is next acquired. */
+  class SharedRing : public Reference::Able
+  {
+  public:
+
+    //! Maximum number of simultaneously attached readers
+    static const unsigned max_readers = 32;
+
+    //! Default constructor
+    SharedRing ();
+
+    //! Destructor detaches from the segment
+    ~SharedRing ();
+
+    //! Create the shared memory segment (writer)
+    void create (key_t key, unsigned nslot, uint64_t slot_bytes,
+                 unsigned header_bytes = 4096);
+
+    //! Attach to an existing shared memory segment (reader)
+    void attach (key_t key);
+
+    //! Detach from (and, if created by this instance, remove) the segment
+    void detach ();
+
+    //! Return true if attached to a segment
+    bool is_attached () const { return control != 0; }
+
+    //! Get the number of slots in the ring
+    unsigned get_nslot () const;
+
+    //! Get the number of bytes in each slot
+    uint64_t get_slot_bytes () const;
+
+    //! Get the size of the ASCII header
+    unsigned get_header_size () const;
+
+    //! Get the ASCII header (writer may modify before publish_header)
+    char* get_header ();
+
+    /** @name writer methods */
+    //@{
+
+    //! Make the header visible to readers
+    void publish_header ();
+
+    //! Wait until nreader readers are attached
+    void wait_readers (unsigned nreader);
+
+    //! Return the next slot to be written, waiting for readers to release it
+    char* open_write ();
+
+    //! Mark the slot returned by open_write as containing bytes
+    void close_write (uint64_t bytes, uint64_t offset);
+
+    //! Signal that no more data will be written
+    void set_eod ();
+
+    //@}
+
+    /** @name reader methods */
+    //@{
+
+    //! Wait for the next slot; returns null at end of data
+    /*! If timeout is not negative, also returns null when no slot is
+      written within timeout seconds; see end_of_data */
+    const char* open_read (uint64_t& bytes, uint64_t& offset,
+                           double timeout = -1.0);
+
+    //! Return true if every slot has been read and no more will be written
+    bool end_of_data ();
+
+    //! Wall-clock time (CLOCK_MONOTONIC) at which the open slot was written
+    double get_slot_time () const { return slot_time; }
+
+    //! Release the slot returned by open_read
+    void close_read ();
+
+    //@}
+
+  protected:
+
+    //! Layout of the control block
+    class Control;
+
+    //! Shared memory identifier
+    int shmid;
+
+    //! Start of the shared memory segment
+    char* base;
+
+    //! Control block at the start of the segment
+    Control* control;
+
+    //! This instance created the segment
+    bool creator;
+
+    //! Index of this reader in the control block
+    int reader;
+
+    //! Time at which the slot returned by open_read was written
+    double slot_time;
+
+    //! Return pointer to the start of the specified slot
+    char* get_slot (uint64_t count);
+
+    //! Map the segment into this process
+    void map (int shmid);
+
+    //! Deactivate readers whose processes no longer exist
+    void check_readers ();
+
+    //! Holds the mutex in the control block
+    class Lock;
+    friend class Lock;
+
+    //! Lock the mutex, recovering the state of a process that died
+    void lock ();
+
+    //! Wait on the condition (until the specified time, if not null)
+    int wait (const struct timespec* until = 0);
+
+    //! Release the resources of a process that died holding the mutex
+    void recover ();
+  };
+
+}
+
+#endif
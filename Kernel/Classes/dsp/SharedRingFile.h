@@ -0,0 +1,85 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_SharedRingFile_h
+#define __dsp_SharedRingFile_h
+
+#include "dsp/File.h"
+#include "dsp/SharedRing.h"
+
+namespace dsp {
+
+  //! Loads unpacked data published to a SharedRing by another process
+  /*! This class pretends to be a file so that it can slip into the
+    File::registry.  The file contains
+
+    DSPSR RING INFO:
+    key <hexadecimal System V IPC key>
+
+    The ring carries 32-bit floats in TFP order with an ASCII header
+    (machine = dspsr), so that the data are loaded by FloatUnpacker. */
+  class SharedRingFile : public File
+  {
+  public:
+
+    //! Constructor
+    SharedRingFile (const char* filename = 0);
+
+    //! Destructor
+    ~SharedRingFile ();
+
+    //! Returns true if filename names a shared ring INFO file
+    bool is_valid (const char* filename) const;
+
+    //! Detach from the shared ring
+    void close ();
+
+  protected:
+
+    //! Attach to the shared ring named in the INFO file
+    virtual void open_file (const char* filename);
+
+    //! Copy bytes out of the shared ring
+    /*! If a deadline is set, returns after the deadline has passed
+      with at least the minimum partial number of samples. */
+    virtual int64_t load_bytes (unsigned char* buffer, uint64_t bytes);
+
+    //! Skip forward to the specified offset (seeking backward is not possible)
+    virtual int64_t seek_bytes (uint64_t bytes);
+
+    //! The total number of samples is unknown
+    virtual void set_total_samples ();
+
+    //! The shared memory ring
+    Reference::To<SharedRing> ring;
+
+    //! The slot currently being read
+    const char* slot;
+
+    //! Number of bytes in the current slot
+    uint64_t slot_bytes;
+
+    //! Number of bytes of the current slot already read
+    uint64_t slot_read;
+
+    //! Offset in the stream of the first byte of the current slot
+    uint64_t slot_offset;
+
+    //! Offset in the stream of the first byte available to this reader
+    uint64_t origin;
+
+    //! Get the next slot; returns false at end of data or after timeout
+    bool next_slot (double timeout = -1.0);
+
+    //! Release the current slot
+    void release_slot ();
+  };
+
+}
+
+#endif // !defined(__dsp_SharedRingFile_h)
@@ -0,0 +1,136 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __SyntheticFile_h
+#define __SyntheticFile_h
+
+#include "dsp/File.h"
+#include "dsp/ThreadPool.h"
+
+namespace dsp {
+
+  //! Generates noise, dispersed pulses and RFI for load and scaling tests
+  /*! The observation is described by an ASCII header (as read by
+    ASCIIObservation) in which the first nine characters are SYNTHETIC.
+    The following optional keywords describe the signal:
+
+    - MAX_DATA_MB  stop after this many megabytes (default: NDAT or never)
+    - SEED         random number generator seed
+    - NTHREAD      number of threads used to generate data
+    - PULSE_PERIOD pulse period in seconds (default: no pulses)
+    - PULSE_DM     dispersion measure of the pulses in pc/cm^3
+    - PULSE_DUTY   fraction of the period in which the pulse is on
+    - PULSE_SNR    pulse power relative to the noise power
+    - RFI_RATE     probability that a time sample contains broad-band RFI
+    - RFI_NCHAN    number of channels with persistent narrow-band RFI
+    - RFI_SNR      RFI power relative to the noise power
+
+    Samples are digitized with optimal thresholds into the layout read
+    by the Dummy unpackers (NBIT 4 or 8) or as floats in the format
+    read by the FloatUnpacker (NBIT 32).  Each sample is drawn from a
+    16-bit look-up table of the inverse cumulative distribution, so
+    that generation costs little more than the random number. */
+  class SyntheticFile : public File, public ThreadPool
+  {
+  public:
+
+    //! Construct and open file
+    SyntheticFile (const char* filename=0);
+
+    //! Destructor
+    ~SyntheticFile ();
+
+    //! Returns true if the first line of filename is SYNTHETIC
+    bool is_valid (const char* filename) const;
+
+    //! Set the number of threads used to generate data
+    void set_nthread (unsigned);
+
+  protected:
+
+    //! Open the file
+    void open_file (const char* filename);
+
+    //! Close
+    void close ();
+
+    //! Generate bytes
+    int64_t load_bytes (unsigned char* buffer, uint64_t bytes);
+
+    //! Seek bytes
+    int64_t seek_bytes (uint64_t bytes);
+
+    //! Set ndat from MAX_DATA_MB
+    void set_total_samples ();
+
+    //! Number of bytes to stop after
+    uint64_t max_bytes;
+
+    //! Current byte offset
+    uint64_t offset;
+
+    //! Random number generator seed
+    uint64_t seed;
+
+    //! Pulse period in seconds
+    double pulse_period;
+
+    //! Dispersion measure of the pulses
+    double pulse_dm;
+
+    //! Fraction of the pulse period in which the pulse is on
+    double pulse_duty;
+
+    //! Pulse power relative to the noise power
+    double pulse_snr;
+
+    //! Probability that a time sample contains broad-band RFI
+    double rfi_rate;
+
+    //! Number of channels with persistent narrow-band RFI
+    unsigned rfi_nchan;
+
+    //! RFI power relative to the noise power
+    double rfi_snr;
+
+    //! Bytes in each frame of nchan*npol*ndim elements
+    unsigned frame_bytes;
+
+    //! Time samples in each frame
+    unsigned frame_ndat;
+
+    //! Pulse delay of each channel, in samples
+    std::vector<double> delay;
+
+    //! Persistent RFI in each channel
+    std::vector<bool> rfi_channel;
+
+    //! Digitized inverse cumulative distribution (noise, pulse, RFI, both)
+    std::vector<unsigned char> code[4];
+
+    //! Inverse cumulative distribution knots when NBIT=32
+    std::vector<float> knot[4];
+
+    //! Build the look-up tables
+    void build_tables ();
+
+    //! Generate nframe frames starting at frame
+    void generate (unsigned char* buffer, uint64_t frame, uint64_t nframe);
+
+    //! the buffer, first frame and number of frames to be generated
+    unsigned char* job_buffer;
+    uint64_t job_frame;
+    uint64_t job_nframe;
+
+    //! Generate the range of seeds assigned to the thread
+    void run_thread (unsigned ithread);
+  };
+
+}
+
+#endif // !defined(__SyntheticFile_h)
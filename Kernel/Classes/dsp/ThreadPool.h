@@ -0,0 +1,95 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_ThreadPool_h
+#define __dsp_ThreadPool_h
+
+#include "Error.h"
+
+#include <pthread.h>
+#include <vector>
+
+class ThreadContext;
+
+namespace dsp {
+
+  //! Divides the work of each call among threads that wait between calls
+  /*! Derived classes implement run_thread, which is called in each
+    thread with the index of the thread every time that run_threads
+    is called.  With a single thread, no threads are launched and
+    run_thread is called by the calling thread.  An Error thrown in
+    any thread is thrown again by run_threads. */
+  class ThreadPool
+  {
+  public:
+
+    //! Default constructor
+    ThreadPool ();
+
+    //! Destructor stops and joins the threads
+    virtual ~ThreadPool ();
+
+    //! Get the number of threads among which the work is divided
+    unsigned get_nthread () const { return nthread; }
+
+  protected:
+
+    //! Stop any running threads and launch nthread new threads
+    void launch_threads (unsigned nthread);
+
+    //! Run each thread once and wait for all of them to complete
+    void run_threads ();
+
+    //! Stops and joins the threads
+    void stop_threads ();
+
+    //! Perform the part of the work assigned to thread ithread
+    virtual void run_thread (unsigned ithread) = 0;
+
+  private:
+
+    //! number of threads
+    unsigned nthread;
+
+    //! Used to communicate between calling thread and pool threads
+    ThreadContext* context;
+
+    //! simple counter for thread identification
+    unsigned thread_count;
+
+    //! thread ids
+    std::vector <pthread_t> ids;
+
+    //! the most recent Error thrown in a thread
+    Error thread_error;
+
+    //! set when a thread throws an Error during run_threads
+    bool thread_failed;
+
+    //! pool_thread calls thread method
+    static void* pool_thread (void*);
+
+    //! The pool thread
+    void thread ();
+
+    enum State { Idle, Active, Quit };
+
+    //! overall state
+    State state;
+
+    //! thread states
+    std::vector <State> states;
+
+    //! Threads are not copied
+    ThreadPool (const ThreadPool&);
+    ThreadPool& operator = (const ThreadPool&);
+  };
+
+}
+
+#endif
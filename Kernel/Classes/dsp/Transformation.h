@@ -15,6 +15,7 @@
 #define __dsp_Transformation_h
 
 #include "dsp/Operation.h"
+#include "dsp/Observation.h"
 #include "dsp/HasInput.h"
 #include "dsp/HasOutput.h"
 #include "dsp/BufferingPolicy.h"
@@ -116,6 +117,19 @@ namespace dsp {
         this->buffering_policy->set_cerr (os);
     }
 
+    //! Add the memory required by the output and buffering policy
+    void add_footprint (Footprint& footprint) const
+    {
+      const Observation* out;
+      out = dynamic_cast<const Observation*>( this->output.ptr() );
+      const Observation* in;
+      in = dynamic_cast<const Observation*>( this->input.ptr() );
+      if (out && out != in && type != inplace)
+        footprint.add_block (out);
+      if (this->buffering_policy)
+        footprint.add_fixed (this->buffering_policy->get_nbytes());
+    }
+
   protected:
 
     //! The buffering policy in place (if any)
@@ -0,0 +1,85 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_WeightMask_h
+#define __dsp_WeightMask_h
+
+#include <vector>
+#include <inttypes.h>
+
+namespace dsp {
+
+  //! One bit per weight, set if the weight is non-zero
+  /*! Masks are stored in 64-bit words, so that combining the masks of
+    different channels and polarizations, and counting the number of
+    valid or invalid weights, operate on 64 weights at a time.  Runs of
+    zero or non-zero weights may be traversed using find, which skips
+    whole words of equal bits.  Bits beyond the last weight are zero. */
+  class WeightMask
+  {
+  public:
+
+    //! Construct a mask of nweight valid weights
+    WeightMask (uint64_t nweight = 0);
+
+    //! Resize the mask; all weights are set valid
+    void resize (uint64_t nweight);
+
+    //! Get the number of weights
+    uint64_t size () const { return nweight; }
+
+    //! Set all weights valid
+    void set ();
+
+    //! Set the valid weights from an array of weights
+    void set (const unsigned* weights, uint64_t nweight);
+
+    //! Set the weights in the range [start, end) invalid
+    void clear (uint64_t start, uint64_t end);
+
+    //! Return true if the specified weight is valid
+    bool test (uint64_t iweight) const
+    { return (word[iweight >> 6] >> (iweight & 63)) & 1; }
+
+    //! Set each invalid weight in the array to zero
+    void apply (unsigned* weights) const;
+
+    //! Invalidate each weight that is invalid in other
+    WeightMask& operator &= (const WeightMask& other);
+
+    //! Validate each weight that is valid in other
+    WeightMask& operator |= (const WeightMask& other);
+
+    //! Return the number of valid weights
+    uint64_t count () const;
+
+    //! Return the number of valid weights in the range [start, end)
+    uint64_t count (uint64_t start, uint64_t end) const;
+
+    //! Return the index of the first weight >= start with the given state
+    /*! Returns size() if there is no such weight */
+    uint64_t find (uint64_t start, bool valid) const;
+
+    //! Return the number of bytes used to store the mask
+    uint64_t get_nbytes () const { return word.size() * sizeof(uint64_t); }
+
+  protected:
+
+    //! The bits
+    std::vector<uint64_t> word;
+
+    //! The number of weights
+    uint64_t nweight;
+
+    //! Clear the unused bits of the last word
+    void trim ();
+  };
+
+}
+
+#endif
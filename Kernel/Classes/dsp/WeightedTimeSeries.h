@@ -15,6 +15,7 @@
 #define __WeightedTimeSeries_h
 
 #include "dsp/TimeSeries.h"
+#include "dsp/WeightMask.h"
 
 namespace dsp {
   
@@ -114,6 +115,9 @@ namespace dsp {
     //! Get the weights array for the specfied polarization and frequency
     const unsigned* get_weights (unsigned ichan=0, unsigned ipol=0) const;
 
+    //! Get the bit mask of valid weights for the specified pol and freq
+    void get_mask (WeightMask&, unsigned ichan=0, unsigned ipol=0) const;
+
     //! Flag all weights in corrupted transforms
     void convolve_weights (unsigned nfft, unsigned nkeep);
 
@@ -162,6 +166,10 @@ namespace dsp {
 
     //! The size of each division of the buffer
     uint64_t weight_subsize;
+
+    //! Bit masks used by mask_weights and convolve_weights
+    WeightMask mask;
+    WeightMask part_mask;
   };
 
 }
@@ -56,6 +56,9 @@ namespace dsp {
 
     //! Load bytes from shared memory
     virtual int64_t load_bytes (unsigned char* buffer, uint64_t bytes);
+
+    //! Load bytes from shared memory until the deadline has passed
+    int64_t load_bytes_before_deadline (unsigned char* buffer, uint64_t bytes);
     
     //! Set the offset in shared memory
     virtual int64_t seek_bytes (uint64_t bytes);
@@ -20,11 +20,18 @@
 // TODO -- since the user can set nbit/nsblk, the instance can be made
 // inconsistent if these methods are called after initialize
 
+// Complete SUBINT rows are assembled in one of two staging batches; while
+// the pipeline fills one batch, the other is written by a background thread
+// with one cfitsio call per column per batch of rows.
+
 #ifndef __FITSOutputFile_h
 #define __FITSOutputFile_h
 
 #include "dsp/OutputFile.h"
 #include <fitsio.h>
+#include <pthread.h>
+
+class ThreadContext;
 
 namespace dsp {
 
@@ -49,6 +56,15 @@ namespace dsp {
     //! Set the number of bits per output sample
     void set_nbit ( unsigned _nbit );
 
+    //! Set the number of rows written per cfitsio call (0 = automatic)
+    void set_nrow_batch ( unsigned nrow );
+
+    //! Set the number of rows to preallocate in the SUBINT table
+    void set_nrow_preallocate ( unsigned nrow );
+
+    //! Write batches of rows from a background thread (default: true)
+    void set_asynchronous ( bool flag );
+
   protected:
 
     //! Need a custom implementation of operation to handle FITS I/O
@@ -102,6 +118,15 @@ namespace dsp {
     //! current subint
     unsigned isub;
 
+    //! rows per staging batch
+    unsigned nrow_batch;
+
+    //! rows preallocated in SUBINT table
+    unsigned nrow_preallocate;
+
+    //! write batches from a background thread
+    bool asynchronous;
+
   private:
 
     //! offset into current block to write new data
@@ -113,11 +138,66 @@ namespace dsp {
     //! set up buffers, etc.
     void initialize ();
 
-    //! helper method for FITS output
-    void write_row ();
-
-
-
+    //! A batch of complete (and possibly one partial) SUBINT rows
+    class Batch
+    {
+    public:
+      //! DATA for nrow_batch rows
+      std::vector<unsigned char> data;
+      //! DAT_SCL for each row, captured when the row was started
+      std::vector<float> scl;
+      //! DAT_OFFS for each row, captured when the row was started
+      std::vector<float> offs;
+      //! one-based index of the first row in the batch
+      unsigned first_row;
+      //! number of rows started in the batch
+      unsigned nrow;
+      //! number of bytes in the last row
+      unsigned last_bytes;
+      //! batch is ready to be written
+      bool full;
+    };
+
+    //! double-buffered staging area
+    Batch batch[2];
+
+    //! the batch currently being filled
+    unsigned ibatch;
+
+    //! column numbers
+    int col_data, col_indexval, col_tsubint, col_offs_sub;
+    int col_dat_wts, col_dat_scl, col_dat_offs, col_dat_freq;
+
+    //! DAT_WTS and DAT_FREQ replicated for nrow_batch rows
+    std::vector<float> batch_wts;
+    std::vector<double> batch_freq;
+
+    //! start a new row in the current batch
+    void start_row ();
+
+    //! hand the current batch to the writer and swap buffers
+    void submit_batch ();
+
+    //! write a batch of rows with cfitsio
+    void write_batch (Batch&);
+
+    //! wait until all submitted batches have been written
+    void wait_written ();
+
+    //! background writer thread
+    static void* writer_thread (void*);
+    void writer ();
+    void start_writer ();
+    void stop_writer ();
+
+    //! coordinates the calling thread and the writer thread
+    ThreadContext* context;
+    pthread_t writer_id;
+    bool writer_running;
+    bool writer_quit;
+
+    //! error message raised in the writer thread
+    std::string writer_error;
   };
 
 }
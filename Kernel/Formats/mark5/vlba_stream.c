@@ -29,9 +29,15 @@
 #include <fcntl.h>
 #include "vlba_stream.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 uint32_t *modbits=0;
 uint64_t *modbits64=0;
 
+static void VLBA_stream_build_decode(struct VLBA_stream *vs);
+
 void initmodbits()
 {
 	int i, n, k;
@@ -507,6 +513,7 @@ void VLBA_stream_set_basebits(struct VLBA_stream *vs, int nchan,
 		}
 	}
 
+	VLBA_stream_build_decode(vs);
 }
 
 static int VLBA_stream_decode_tracks(struct VLBA_stream *vs)
@@ -670,6 +677,8 @@ struct VLBA_stream *VLBA_stream_generic_open(struct VLBA_stream_generic *V,
 	vs->bits = bits;
 	vs->fanout = fanout;
 	vs->basebits = 0;
+	vs->decode = 0;
+	vs->decode_nout = 0;
 	vs->read_position = 0;
 	vs->init = V->init;
 	vs->next = V->next;
@@ -779,6 +788,10 @@ void VLBA_stream_close(struct VLBA_stream *vs)
 		{
 			free(vs->basebits);
 		}
+		if(vs->decode)
+		{
+			free(vs->decode);
+		}
 		free(vs);
 	}
 }
@@ -805,286 +818,106 @@ void VLBA_stream_print(const struct VLBA_stream *vs)
 
 /*********************** data unpack routines **********************/
 
-static int VLBA_stream_get_data_2bit8(struct VLBA_stream *vs, int nsamp, 
-	float **data)
+/* Build the table used to decode each byte of a word into the state
+ * (0..3 for 2-bit, 0..1 for 1-bit samples) of every channel and fanout.
+ * Each decoded sample takes its sign and magnitude bits from at most two
+ * bytes, so the state is the bitwise OR of the entries for all bytes.
+ * Entries are ordered by fanout, then channel.
+ */
+static void VLBA_stream_build_decode(struct VLBA_stream *vs)
 {
-	const float lut[4] = {-3.3359, 1.0, -1.0, 3.3359};
-	uint8_t *buf, p;
-	int i, o, s, c, m, f;
-	int index;
+	int nbyte, nout, step, s, m, c, f, k, v;
+	unsigned char *t;
 
-	buf = (uint8_t *)(vs->payload);
-	if(buf == 0)
+	if(vs->decode)
 	{
-		return -1;
+		free(vs->decode);
+		vs->decode = 0;
 	}
 
-	o = vs->read_position;
+	nbyte = vs->tracks/8;
+	nout = vs->nchan*vs->fanout;
+	vs->decode_nout = nout;
 
-	for(i = 0; i < nsamp; i+=vs->fanout)
+	if(nbyte < 1 || nbyte > 8 || nout < 1 || nout > 64)
 	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-			{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
-		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+f;
-					m = s + vs->fanout;
-					index = ((p>>s)&1) + (((p>>m)&1)<<1);
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
-			}
-		}
-
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = (uint8_t *)(vs->payload);
-			o = 0;
-		}
+		return;
 	}
 
-	vs->read_position = o;
-
-	return 0;
-}
-
-static int VLBA_stream_get_data_1bit8(struct VLBA_stream *vs, int nsamp, 
-	float **data)
-{
-	const float lut[2] = {1.0, -1.0};
-	uint8_t *buf, p;
-	int i, o, s, c, f;
-	int index;
-
-	buf = (uint8_t *)(vs->payload);
-	if(buf == 0)
-	{
-		return -1;
-	}
+	/* 32 and 64 track modes interleave the fanout bits */
+	step = (vs->tracks > 16) ? 2 : 1;
 
-	o = vs->read_position;
+	vs->decode = (unsigned char *)calloc(nbyte*256*nout, 1);
 
-	for(i = 0; i < nsamp; i+=vs->fanout)
+	for(f = 0; f < vs->fanout; f++)
 	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
+		for(c = 0; c < vs->nchan; c++)
 		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
-		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-			{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+f;
-					index = (p>>s)&1;
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
-			}
-		}
+			k = f*vs->nchan + c;
+			s = vs->basebits[c] + step*f;
+			m = s + step*vs->fanout;
 
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
+			for(v = 0; v < 256; v++)
 			{
-				return -1;
-			}
-			buf = (uint8_t *)(vs->payload);
-			o = 0;
-		}
-	}
-
-	vs->read_position = o;
-
-	return 0;
-}
-
-static int VLBA_stream_get_data_2bit16(struct VLBA_stream *vs, int nsamp, 
-	float **data)
-{
-	const float lut[4] = {-3.3359, 1.0, -1.0, 3.3359};
-	uint16_t *buf, p;
-	int i, o, s, c, m, f;
-	int index;
-
-	buf = (uint16_t *)(vs->payload);
-	if(buf == 0)
-	{
-		return -1;
-	}
-
-	o = vs->read_position;
-
-	for(i = 0; i < nsamp; i+=vs->fanout)
-	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
+				if(s < vs->tracks)
 				{
-					data[c][i+f] = 0.0;
+					t = vs->decode + ((s/8)*256 + v)*nout;
+					t[k] |= (v >> (s%8)) & 1;
 				}
-			}
-		}
-		else
-		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
+				if(vs->bits == 2 && m < vs->tracks)
 				{
-					s = vs->basebits[c]+f;
-					m = s + vs->fanout;
-					index = ((p>>s)&1) + (((p>>m)&1)<<1);
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
+					t = vs->decode + ((m/8)*256 + v)*nout;
+					t[k] |= ((v >> (m%8)) & 1) << 1;
 				}
 			}
 		}
-
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = (uint16_t *)(vs->payload);
-			o = 0;
-		}
 	}
-
-	vs->read_position = o;
-
-	return 0;
 }
 
-static int VLBA_stream_get_data_1bit16(struct VLBA_stream *vs, int nsamp, 
-	float **data)
+/* Decode the states of all channels and fanouts in one word */
+static inline void VLBA_stream_decode_word(const struct VLBA_stream *vs,
+	uint64_t p, int nbyte, unsigned char *code)
 {
-	const float lut[2] = {1.0, -1.0};
-	uint16_t *buf, p;
-	int i, o, s, c, f;
-	int index;
+	const int nout = vs->decode_nout;
+	const unsigned char *t;
+	int b, k;
 
-	buf = (uint16_t *)(vs->payload);
-	if(buf == 0)
-	{
-		return -1;
-	}
+	memcpy(code, vs->decode + (p & 0xff)*nout, nout);
 
-	o = vs->read_position;
-
-	for(i = 0; i < nsamp; i+=vs->fanout)
+	for(b = 1; b < nbyte; b++)
 	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
+		t = vs->decode + (b*256 + ((p >> (8*b)) & 0xff))*nout;
+		k = 0;
+#ifdef __SSE2__
+		for(; k + 16 <= nout; k += 16)
 		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+f;
-					index = (p>>s)&1;
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
-			}
+			__m128i x = _mm_loadu_si128((const __m128i *)(code + k));
+			__m128i y = _mm_loadu_si128((const __m128i *)(t + k));
+			_mm_storeu_si128((__m128i *)(code + k), _mm_or_si128(x, y));
 		}
-
-		o++;
-		if(o >= PAYLOADSIZE)
+#endif
+		for(; k < nout; k++)
 		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = (uint16_t *)(vs->payload);
-			o = 0;
+			code[k] |= t[k];
 		}
 	}
-
-	vs->read_position = o;
-
-	return 0;
 }
 
-static int VLBA_stream_get_data_2bit32(struct VLBA_stream *vs, int nsamp, 
+/* Unpacks 1- or 2-bit data with any number of tracks.  Each word is
+ * demodulated with a single XOR and then decoded by table lookup of
+ * each of its bytes, rather than by extracting every bit in turn. */
+static int VLBA_stream_get_data_decode(struct VLBA_stream *vs, int nsamp, 
 	float **data)
 {
-	const float lut[4] = {-3.3359, 1.0, -1.0, 3.3359};
-	uint32_t *buf, p;
-	int i, o, s, c, m, f;
-	int index;
+	const float lut2[4] = {-3.3359, 1.0, -1.0, 3.3359};
+	const float lut1[2] = {1.0, -1.0};
+	const float *lut = (vs->bits == 2) ? lut2 : lut1;
+	const int nbyte = vs->tracks/8;
+	unsigned char code[64];
+	uint64_t p;
+	int i, o, c, f, k;
 
-	buf = vs->payload;
-	if(buf == 0)
+	if(vs->payload == 0 || vs->decode == 0)
 	{
 		return -1;
 	}
@@ -1095,76 +928,8 @@ static int VLBA_stream_get_data_2bit32(struct VLBA_stream *vs, int nsamp,
 	{
 		if(o < vs->firstvalid || o > vs->lastvalid)
 		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
-		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
 			for(f = 0; f < vs->fanout; f++) 
 			{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+2*f;
-					m = s + 2*vs->fanout;
-					index = ((p>>s)&1) + (((p>>m)&1)<<1);
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
-			}
-		}
-
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = vs->payload;
-			o = 0;
-		}
-	}
-
-	vs->read_position = o;
-
-	return 0;
-}
-
-static int VLBA_stream_get_data_1bit32(struct VLBA_stream *vs, int nsamp, 
-	float **data)
-{
-	const float lut[2] = {1.0, -1.0};
-	uint32_t *buf, p;
-	int i, o, s, c, f;
-	int index;
-
-	buf = vs->payload;
-	if(buf == 0)
-	{
-		return -1;
-	}
-
-	o = vs->read_position;
-
-	for(i = 0; i < nsamp; i+=vs->fanout)
-	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
 				for(c = 0; c < vs->nchan; c++)
 				{
 					data[c][i+f] = 0.0;
@@ -1173,157 +938,36 @@ static int VLBA_stream_get_data_1bit32(struct VLBA_stream *vs, int nsamp,
 		}
 		else
 		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits[o];
-			}
-			else
+			switch(nbyte)
 			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+2*f;
-					index = (p>>s)&1;
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
+			case 1:
+				p = ((const uint8_t *)vs->payload)[o];
+				break;
+			case 2:
+				p = ((const uint16_t *)vs->payload)[o];
+				break;
+			case 4:
+				p = ((const uint32_t *)vs->payload)[o];
+				break;
+			default:
+				p = ((const uint64_t *)vs->payload)[o];
+				break;
 			}
-		}
 
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = vs->payload;
-			o = 0;
-		}
-	}
-
-	vs->read_position = o;
-
-	return 0;
-}
-
-static int VLBA_stream_get_data_2bit64(struct VLBA_stream *vs, int nsamp, 
-	float **data)
-{
-	const float lut[4] = {-3.3359, 1.0, -1.0, 3.3359};
-	uint64_t *buf, p;
-	int f, o, i, m, s, c;
-	int index;
-
-	buf = (uint64_t *)(vs->payload);
-	if(buf == 0)
-	{
-		return -1;
-	}
-	
-	o = vs->read_position;
-	
-	for(i = 0; i < nsamp; i+=vs->fanout)
-	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
-		{
 			if(vs->format == FORMAT_VLBA)
 			{
-				p = buf[o] ^ modbits64[o];
+				p ^= modbits64[o];
 			}
-			else
-			{
-				p = buf[o];
-			}
-			for(f = 0; f < vs->fanout; f++) 
-			{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					s = vs->basebits[c]+2*f;
-					m = s + 2*vs->fanout;
-					index = ((p>>s)&1) + (((p>>m)&1)<<1);
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
-				}
-			}
-		}
 
-		o++;
-		if(o >= PAYLOADSIZE)
-		{
-			if(next_frame(vs) < 0)
-			{
-				return -1;
-			}
-			buf = (uint64_t *)(vs->payload);
-			o = 0;
-		}
-	}
-
-	vs->read_position = o;
+			VLBA_stream_decode_word(vs, p, nbyte, code);
 
-	return 0;
-}
-
-static int VLBA_stream_get_data_1bit64(struct VLBA_stream *vs, int nsamp, 
-	float **data)
-{
-	const float lut[2] = {1.0, -1.0};
-	uint64_t *buf, p;
-	int f, o, i, s, c;
-	int index;
-
-	buf = (uint64_t *)(vs->payload);
-	if(buf == 0)
-	{
-		return -1;
-	}
-	
-	o = vs->read_position;
-	
-	for(i = 0; i < nsamp; i+=vs->fanout)
-	{
-		if(o < vs->firstvalid || o > vs->lastvalid)
-		{
-			for(f = 0; f < vs->fanout; f++) 
-		    	{
-				for(c = 0; c < vs->nchan; c++)
-				{
-					data[c][i+f] = 0.0;
-				}
-			}
-		}
-		else
-		{
-			if(vs->format == FORMAT_VLBA)
-			{
-				p = buf[o] ^ modbits64[o];
-			}
-			else
-			{
-				p = buf[o];
-			}
+			k = 0;
 			for(f = 0; f < vs->fanout; f++) 
 			{
-				for(c = 0; c < vs->nchan; c++)
+				for(c = 0; c < vs->nchan; c++, k++)
 				{
-					s = vs->basebits[c]+2*f;
-					index = (p>>s)&1;
-					data[c][i+f] = lut[index];
-					vs->statecount[c][index]++;
+					data[c][i+f] = lut[code[k]];
+					vs->statecount[c][code[k]]++;
 				}
 			}
 		}
@@ -1335,7 +979,6 @@ static int VLBA_stream_get_data_1bit64(struct VLBA_stream *vs, int nsamp,
 			{
 				return -1;
 			}
-			buf = (uint64_t *)(vs->payload);
 			o = 0;
 		}
 	}
@@ -1345,47 +988,25 @@ static int VLBA_stream_get_data_1bit64(struct VLBA_stream *vs, int nsamp,
 	return 0;
 }
 
-
 int VLBA_stream_get_data(struct VLBA_stream *vs, int nsamp, float **data)
 {
-	if(vs->bits == 2) 
-	{
-		switch(vs->tracks)
-		{
-		case 8:
-			return VLBA_stream_get_data_2bit8(vs, nsamp, data);
-		case 16:
-			return VLBA_stream_get_data_2bit16(vs, nsamp, data);
-		case 32:
-			return VLBA_stream_get_data_2bit32(vs, nsamp, data);
-		case 64:
-			return VLBA_stream_get_data_2bit64(vs, nsamp, data);
-		default:
-			return 0;
-		}
-	}
-	else if(vs->bits == 1)
-	{
-		switch(vs->tracks)
-		{
-		case 8:
-			return VLBA_stream_get_data_1bit8(vs, nsamp, data);
-		case 16:
-			return VLBA_stream_get_data_1bit16(vs, nsamp, data);
-		case 32:
-			return VLBA_stream_get_data_1bit32(vs, nsamp, data);
-		case 64:
-			return VLBA_stream_get_data_1bit64(vs, nsamp, data);
-		default:
-			return 0;
-		}
-	}
-	else 
+	if(vs->bits != 1 && vs->bits != 2)
 	{
 		fprintf(stderr, "VLBA_stream_get_data: only 1 or 2 bits "
 				"allowed now\n");
 		return -1;
 	}
+
+	switch(vs->tracks)
+	{
+	case 8:
+	case 16:
+	case 32:
+	case 64:
+		return VLBA_stream_get_data_decode(vs, nsamp, data);
+	default:
+		return 0;
+	}
 }
 
 int VLBA_stream_get_data_double(struct VLBA_stream *vs, int nsamp, 
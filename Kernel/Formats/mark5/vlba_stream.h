@@ -77,6 +77,8 @@ struct VLBA_stream
 	uint32_t *payload;
 	int payload_offset;	/* == payload - frame */
 	int statecount[16][4];
+	unsigned char *decode;	/* per-byte state table; see set_basebits */
+	int decode_nout;	/* nchan*fanout entries per byte value */
 
 	int (*init)(struct VLBA_stream *vs);
 	int (*next)(struct VLBA_stream *vs);
@@ -15,11 +15,12 @@
 #define __SigProcDigitizer_h
 
 #include "dsp/Digitizer.h"
+#include "dsp/OrderPreference.h"
 
 namespace dsp
 {  
   //! Converts floating point values to N-bit sigproc filterbank format
-  class SigProcDigitizer: public Digitizer
+  class SigProcDigitizer: public Digitizer, public OrderPreference
   {
   public:
 
@@ -34,6 +35,9 @@ namespace dsp
     //! Special case for floating point data
     void pack_float ();
 
+    //! Return the cost of packing data in the specified order
+    double get_order_cost (TimeSeries::Order) const;
+
   };
 }
 
@@ -10,13 +10,22 @@
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
 #include "dsp/Response.h"
+#include "dsp/ThreadPool.h"
+
+#include "FTransform.h"
 
 namespace dsp {
   
   class Apodization;
 
   //! Produces the bandpass of an undetected timeseries.
-  class Bandpass : public Transformation<TimeSeries, Response> {
+  /*! The spectra of each block may be divided between threads, each of
+    which integrates a partial bandpass that is added to the output when
+    the block is done.  If an interval is set, the integrated bandpass is
+    passed to the integrated callback and reset after the first block
+    that completes each interval. */
+  class Bandpass : public Transformation<TimeSeries, Response>,
+		   public ThreadPool {
 
   public:
 
@@ -54,12 +63,32 @@ namespace dsp {
     //! Set the integration length and bandpass to zero
     void reset_output();
 
+    //! Set the number of threads among which the spectra are divided
+    void set_nthread (unsigned);
+
+    //! Set the interval (in seconds) between integrated bandpasses
+    void set_interval_seconds (double seconds) { interval_seconds = seconds; }
+
+    //! Get the interval (in seconds) between integrated bandpasses
+    double get_interval_seconds () const { return interval_seconds; }
+
+    //! Called with each bandpass integrated over the interval
+    /*! The output is reset when the callback returns. */
+    Callback<Bandpass*> integrated;
+
   protected:
     
     //! Perform the transformation on the input time series
     void transformation ();
     void detected_input ();
 
+    //! Integrate the power spectra of undetected input
+    void spectra ();
+
+    //! Integrate the spectra in the range [start, end) of each channel
+    void form (uint64_t start, uint64_t end, Response* into,
+	       std::vector<float>& spectrum);
+
     //! Number of channels in bandpass
     unsigned resolution;
 
@@ -74,6 +103,35 @@ namespace dsp {
 
     //! Frequency response (fractional delay and fringe, for example)
     Reference::To<Response> response;
+
+    //! Interval between integrated bandpasses in seconds
+    double interval_seconds;
+
+    //! The forward FFT plan
+    FTransform::Plan* forward;
+
+    //! The transform size of the forward plan
+    unsigned plan_size;
+
+    //! The type of the forward plan
+    FTransform::type plan_type;
+
+    //! Number of spectra in each channel of the current block
+    uint64_t npart;
+
+    //! Form the cross-polarization spectra
+    bool full_poln;
+
+  private:
+
+    //! spectrum buffer for each thread
+    std::vector< std::vector<float> > thread_spectrum;
+
+    //! partial bandpass integrated by each thread
+    std::vector< Reference::To<Response> > partial;
+
+    //! Integrate the range of spectra assigned to the thread
+    void run_thread (unsigned ithread);
   };
 
 }
@@ -0,0 +1,130 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_BlockSizeTuner_h
+#define __dsp_BlockSizeTuner_h
+
+#include "ReferenceAble.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <inttypes.h>
+
+namespace dsp {
+
+  //! Chooses the block size that maximizes the measured throughput
+  /*! Each candidate block size is used to process a number of blocks,
+    during which the time spent in each stage of the pipeline is
+    recorded.  Once every candidate has been tried, the block size that
+    processed the most time samples per second is selected.
+
+    The selection may be stored in a cache, keyed by a string that
+    describes the host, input configuration and pipeline, so that
+    subsequent runs with the same configuration need not repeat the
+    trials. */
+  class BlockSizeTuner : public Reference::Able
+  {
+  public:
+
+    //! Verbosity flag
+    static bool verbose;
+
+    //! Default constructor
+    BlockSizeTuner ();
+
+    //! Set the number of blocks processed with each candidate
+    void set_nblock (unsigned);
+    unsigned get_nblock () const { return nblock; }
+
+    //! Add a candidate block size
+    void add_candidate (uint64_t block_size);
+    unsigned get_ncandidate () const { return candidate.size(); }
+
+    //! Set the key under which the selection is cached
+    void set_key (const std::string& _key) { key = _key; }
+    const std::string& get_key () const { return key; }
+
+    //! Search the cache for a previous selection
+    /*! Returns true and selects the cached block size if it matches
+      one of the candidates */
+    bool lookup ();
+
+    //! Store the selection in the cache
+    void save () const;
+
+    //! Return true when the block size has been selected
+    bool done () const { return current == candidate.size(); }
+
+    //! Get the block size that should be used for the next block
+    uint64_t get_block_size () const;
+
+    //! Record the time spent in a stage of the pipeline
+    void add_stage (const std::string& name, double seconds);
+
+    //! Record the end of a block of ndat new time samples
+    /*! Returns true if the block size should be changed */
+    bool end_block (uint64_t ndat);
+
+    //! Print the throughput of each stage and candidate
+    void report (std::ostream&) const;
+
+    //! Return the name of the file in which selections are cached
+    static std::string get_cache_filename ();
+
+  protected:
+
+    class Candidate
+    {
+    public:
+      Candidate () : block_size(0), nblock(0), ndat(0) {}
+
+      //! The block size
+      uint64_t block_size;
+      //! The number of blocks measured
+      unsigned nblock;
+      //! The number of new time samples processed
+      uint64_t ndat;
+      //! The time spent in each stage
+      std::vector<double> seconds;
+
+      //! Return the total time spent in all stages
+      double get_seconds () const;
+    };
+
+    //! The candidates
+    std::vector<Candidate> candidate;
+
+    //! Names of the pipeline stages
+    std::vector<std::string> stage;
+
+    //! Index of the stage timed next
+    unsigned istage;
+
+    //! Index of the candidate being measured
+    unsigned current;
+
+    //! Number of blocks processed with the current candidate
+    unsigned iblock;
+
+    //! Index of the selected candidate
+    unsigned best;
+
+    //! Number of blocks processed with each candidate
+    unsigned nblock;
+
+    //! Key used to cache the selection
+    std::string key;
+
+    //! Select the candidate with the highest throughput
+    void select ();
+  };
+
+}
+
+#endif
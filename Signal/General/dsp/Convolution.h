@@ -70,6 +70,9 @@ namespace dsp {
     //! Reserve the maximum amount of output space required
     void reserve ();
 
+    //! Add the output, scratch space, FFT plans and response
+    void add_footprint (Footprint&) const;
+
     //! Get the minimum number of samples required for operation
     uint64_t get_minimum_samples () { return nsamp_fft; }
 
@@ -19,6 +19,7 @@ class Detection;
 
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/OrderPreference.h"
 
 namespace dsp {
 
@@ -38,7 +39,8 @@ namespace dsp {
   are called.
 
   */
-  class Detection : public Transformation <TimeSeries, TimeSeries> {
+  class Detection : public Transformation <TimeSeries, TimeSeries>,
+                    public OrderPreference {
 
   public:
     
@@ -61,6 +63,9 @@ namespace dsp {
     //! Return true if the specified input data order can be supported
     bool get_order_supported (TimeSeries::Order) const;
 
+    //! Return the cost of detecting data in the specified order
+    double get_order_cost (TimeSeries::Order) const;
+
     //! Engine used to perform discrete convolution step
     class Engine;
     void set_engine (Engine*);
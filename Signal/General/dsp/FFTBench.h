@@ -0,0 +1,70 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __FFTBench_h_
+#define __FFTBench_h_
+
+#include "FTransformBench.h"
+#include "FTransformAgent.h"
+
+#include <set>
+
+namespace dsp {
+
+  //! Measures the cost of complex FFTs on the running host
+  /*! Rather than reading benchmarks installed with the software (which
+    may have been measured on different hardware), each available FFT
+    library is timed in-process, using plans obtained from its own
+    FTransform::Agent so that the library used by other threads is not
+    changed.  Only the lengths added with add_nfft are measured.  The
+    results are cached in the user cache directory, in a file named
+    after the host, library and number of threads, so that each length
+    is measured only once per configuration. */
+  class FFTBench : public FTransform::Bench
+  {
+  public:
+
+    //! Default maximum FFT length
+    static unsigned default_max_nfft;
+
+    //! Default constructor
+    FFTBench ();
+
+    //! Set the maximum FFT length that may be measured
+    void set_max_nfft (unsigned);
+
+    //! Get the maximum FFT length that may be measured
+    unsigned get_max_size () const { return max_size; }
+
+    //! Add an FFT length to be measured
+    void add_nfft (unsigned nfft);
+
+    //! Return the name of the file in which results are cached
+    std::string get_filename (const std::string& library) const;
+
+  protected:
+
+    //! The maximum FFT length that may be measured
+    unsigned max_size;
+
+    //! The FFT lengths to be measured
+    std::set<unsigned> lengths;
+
+    //! Load cached results or measure each library
+    void load () const;
+
+    //! Load cached results or measure the library of the agent
+    void load (FTransform::Agent*) const;
+
+    //! Return the time required to execute an FFT in microseconds
+    double measure (FTransform::Agent*, unsigned nfft,
+                    std::vector<float>& buffer) const;
+  };
+}
+
+#endif
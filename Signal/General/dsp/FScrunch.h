@@ -11,15 +11,22 @@
 
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/OrderPreference.h"
 
 namespace dsp {
 
   //! Decimates a TimeSeries in the frequency domain
-  class FScrunch : public Transformation <TimeSeries, TimeSeries>
+  class FScrunch : public Transformation <TimeSeries, TimeSeries>,
+                   public OrderPreference
   {
 
   public:
 
+    //! Channels are summed in a single pass in either order
+    /*! An Engine (e.g. on the GPU) supports only FPT order */
+    double get_order_cost (TimeSeries::Order order) const
+    { return (engine && order != TimeSeries::OrderFPT) ? -1.0 : 1.0; }
+
     FScrunch (Behaviour place=anyplace);
     
     void set_factor ( unsigned samples );
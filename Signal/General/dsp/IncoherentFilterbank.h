@@ -11,7 +11,9 @@
 
 #include "dsp/TimeSeries.h"
 #include "dsp/Transformation.h"
+#include "dsp/ThreadPool.h"
 
+#include "FTransform.h"
 #include "RealTimer.h"
 
 /*
@@ -25,7 +27,8 @@ dsp::Observation::get_base_frequency().  HSK
 
 namespace dsp{
 
-  class IncoherentFilterbank : public Transformation<TimeSeries,TimeSeries>{
+  class IncoherentFilterbank : public Transformation<TimeSeries,TimeSeries>,
+			       public ThreadPool {
 
   public:
 
@@ -36,10 +39,10 @@ namespace dsp{
     virtual ~IncoherentFilterbank();
   
     //! Inquire transform size of current plan (zero=no plan)
-    uint64_t get_plansize(){ return wsave_size; }
+    uint64_t get_plansize(){ return plan_size; }
 
-    //! Free up the memory used by the current plan
-    void free_plan(){ if(wsave) delete [] wsave; wsave = 0; wsave_size = 0; }
+    //! Release the current plan
+    void free_plan(){ forward = 0; plan_size = 0; }
     
     //! Set the number of channels
     void set_nchan(unsigned _nchan){ nchan = _nchan; }
@@ -53,17 +56,14 @@ namespace dsp{
     //! Inquire the output state- default is Intensity
     Signal::State get_output_state(){ return state; }
 
-    //! Inquire timings
+    //! Set the number of threads among which the spectra are divided
+    void set_nthread (unsigned);
+
+    //! Inquire timings (measured only when there is a single thread)
     double get_fft_time(){ return fft_timer.get_total(); }
     double get_fft_loop_time(){ return fft_loop_timer.get_total(); }
     double get_conversion_time(){ return conversion_timer.get_total(); }
 
-    //! Inquire loop unroll level for forming incoherent filterbank
-    unsigned get_unroll_level(){ return unroll_level; }
-    
-    //! Set loop unroll level for forming incoherent filterbank
-    void set_unroll_level(unsigned _unroll_level){ unroll_level = _unroll_level; }
-
     //! Inquire whether input can be destroyed upon call to operate()
     bool get_destroy_input(){ return destroy_input; }
     
@@ -78,23 +78,21 @@ namespace dsp{
     //! Number of channels into which the input will be divided
     unsigned nchan;
 
-    //! Memory used by MKL to store transform coefficients (ie the plan)
-    float* wsave; 
-    
-    //! The size of the memory allocated to wsave;
-    uint64_t wsave_size;
+    //! The forward FFT plan
+    FTransform::Plan* forward;
+
+    //! The transform size of the forward plan
+    uint64_t plan_size;
 
     //! The output's state (ie the number of polarisations)
     Signal::State state;
 
-    //! Worker function for state=Signal::Intensity
-    virtual void form_stokesI();
-
-    //! Worker function for state=Signal::PPQQ
-    virtual void form_PPQQ();
+    //! Number of spectra computed before transposing into the output
+    unsigned nblock;
 
-    //! Worker function for state=Signal::Analytic
-    virtual void form_undetected();
+    //! Form the filterbank for the spectra in the range [start, end)
+    void form (uint64_t start, uint64_t end, std::vector<float>& scratch,
+	       bool timing);
 
     //! Timer for FFT'ing
     RealTimer fft_timer;
@@ -105,12 +103,20 @@ namespace dsp{
     //! Timer for TimeSeries conversion
     RealTimer conversion_timer;
 
-    //! Loop unroll level for forming undetected filterbank
-    unsigned unroll_level;
-
     //! If set to true, the input data array may be destroyed on the call to operation()
     bool destroy_input;
 
+  private:
+
+    //! Number of spectra in the current block of data
+    uint64_t npart;
+
+    //! scratch space for each thread
+    std::vector< std::vector<float> > scratch;
+
+    //! Form the filterbank for the range of spectra assigned to the thread
+    void run_thread (unsigned ithread);
+
   };
 
 }
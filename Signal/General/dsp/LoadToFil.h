@@ -82,6 +82,9 @@ namespace dsp {
     //! Filterbank config options
     Filterbank::Config filterbank;
 
+    //! number of threads used by the TFP filterbank
+    unsigned filterbank_nthread;
+
     //! dispersion measure set in output file
     double dispersion_measure;
 
@@ -18,6 +18,8 @@
 
 namespace dsp
 {  
+  class FFTBench;
+
   //! Chooses the optimal FFT length for Filterbank and/or Convolution
   class OptimalFFT : public Reference::Able
   {
@@ -25,6 +27,9 @@ namespace dsp
 
     static bool verbose;
 
+    //! Use the benchmarks installed with the software (filterbank_bench.csh)
+    static bool use_installed_bench;
+
     OptimalFFT ();
 
     //! Set true when convolution is performed during filterbank synthesis
@@ -47,6 +52,13 @@ namespace dsp
 
     virtual FTransform::Bench* new_bench () const;
 
+    //! Add the FFT lengths required to compute the cost of nfft
+    void add_lengths (FFTBench*, unsigned nfft) const;
+
+    //! Replace best_nfft and best_cost if nfft costs less
+    void compare (unsigned nfft, unsigned nfilt,
+                  unsigned& best_nfft, double& best_cost) const;
+
     unsigned nchan;
     bool simultaneous;
   };
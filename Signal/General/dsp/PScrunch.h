@@ -16,17 +16,22 @@
 
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/OrderPreference.h"
 
 #include <vector>
 
 namespace dsp
 {
   //! PScrunch all channels and polarizations
-  class PScrunch : public Transformation<TimeSeries,TimeSeries>
+  class PScrunch : public Transformation<TimeSeries,TimeSeries>,
+                   public OrderPreference
   {
 
   public:
 
+    //! The polarizations of each sample are summed in either order
+    double get_order_cost (TimeSeries::Order) const { return 1.0; }
+
     //! Default constructor
     PScrunch ();
 
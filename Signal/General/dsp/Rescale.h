@@ -16,6 +16,7 @@
 
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/OrderPreference.h"
 #include "dsp/BandpassMonitor.h"
 
 #include <vector>
@@ -23,11 +24,15 @@
 namespace dsp
 {
   //! Rescale all channels and polarizations
-  class Rescale : public Transformation<TimeSeries,TimeSeries>
+  class Rescale : public Transformation<TimeSeries,TimeSeries>,
+                  public OrderPreference
   {
 
   public:
 
+    //! The offset and scale of each channel are applied in either order
+    double get_order_cost (TimeSeries::Order) const { return 1.0; }
+
     //! Default constructor
     Rescale ();
 
@@ -90,6 +95,16 @@ namespace dsp
 
     std::vector< std::vector<float> > decay_offset;
 
+    //! The mean of the previous interval, about which data are accumulated
+    std::vector< std::vector<float> > shift;
+
+    //! Offset, scale, shift, and accumulators in TFP order
+    std::vector<float> tfp_offset;
+    std::vector<float> tfp_scale;
+    std::vector<float> tfp_shift;
+    std::vector<double> tfp_sum;
+    std::vector<double> tfp_sumsq;
+
     bool output_time_total;
     bool output_after_interval;
 
@@ -108,6 +123,15 @@ namespace dsp
 
     void init ();
     void compute_various (bool first_call = false);
+
+    //! Accumulate statistics and, optionally, rescale the output
+    void accumulate (uint64_t start_dat, uint64_t end_dat, bool apply_scale);
+
+    //! Rescale the output
+    void apply (uint64_t start_dat, uint64_t end_dat);
+
+    //! Rescale one TFP sample and subtract the exponential smooth
+    void apply_decay (float* out_data, const float* in_data);
   };
 }
 
@@ -0,0 +1,92 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_SharedRingOutput_h_
+#define __dsp_SharedRingOutput_h_
+
+#include "dsp/Sink.h"
+#include "dsp/TimeSeries.h"
+#include "dsp/SharedRing.h"
+
+namespace dsp {
+
+  //! Publishes TimeSeries data to a SharedRing for other processes
+  /*! Data are written as 32-bit floats in TFP order after a DADA-style
+    ASCII header, as in the binary mode of Dump, so that each process
+    attached with SharedRingFile can load them with FloatUnpacker.  The
+    input is therefore loaded and unpacked only once.
+
+    Consecutive files may be written to the same ring, provided that
+    they are contiguous and have the same shape and sampling rate as
+    the first block, which is described by the ring header. */
+  class SharedRingOutput : public Sink<TimeSeries>
+  {
+  public:
+
+    //! Default constructor
+    SharedRingOutput (const char* name = "SharedRingOutput");
+
+    //! Destructor signals end of data and removes the ring
+    ~SharedRingOutput ();
+
+    //! Set the System V IPC key of the shared memory ring
+    void set_key (key_t _key) { key = _key; }
+
+    //! Set the number of slots in the ring
+    void set_nslot (unsigned n) { nslot = n; }
+
+    //! Set the number of readers to wait for before writing the first block
+    void set_nreader (unsigned n) { nreader = n; }
+
+    //! Write the INFO file used to open the ring with SharedRingFile
+    void write_info (const std::string& filename) const;
+
+    //! Signal end of data to all readers
+    void finish ();
+
+    Operation::Function get_function () const { return Operation::Structural; }
+
+  protected:
+
+    //! Copy the input into the next slots of the ring
+    void calculation ();
+
+    //! Create the ring and publish the header
+    void initialize (const TimeSeries*);
+
+    //! Return the offset in samples of the block from the start of the ring
+    int64_t get_position (const TimeSeries*) const;
+
+    //! The shared memory ring
+    Reference::To<SharedRing> ring;
+
+    //! The System V IPC key
+    key_t key;
+
+    //! Number of slots in the ring
+    unsigned nslot;
+
+    //! Number of readers to wait for
+    unsigned nreader;
+
+    //! Start time of the first sample written to the ring
+    MJD start_time;
+
+    //! Sampling rate of the data in the ring
+    double rate;
+
+    //! Number of samples written to the ring
+    uint64_t next_sample;
+
+    //! Bytes per sample in TFP order
+    uint64_t sample_bytes;
+  };
+
+}
+
+#endif
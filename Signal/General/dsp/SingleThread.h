@@ -15,6 +15,8 @@
 #define __dspsr_SingleThread_h
 
 #include "dsp/Pipeline.h"
+#include "dsp/Operation.h"
+#include "dsp/TimeSeries.h"
 #include "CommandLine.h"
 #include "Functor.h"
 #include "TextEditor.h"
@@ -24,11 +26,10 @@ class ThreadContext;
 namespace dsp {
 
   class IOManager;
-  class TimeSeries;
-  class Operation;
   class Observation;
   class Scratch;
   class Memory;
+  class BlockSizeTuner;
 
   //! A single Pipeline thread
   class SingleThread : public Pipeline
@@ -63,6 +64,9 @@ namespace dsp {
     //! Prepare the signal processing pipeline
     void prepare ();
 
+    //! Add the memory required by each operation (call after prepare)
+    void add_footprint (Operation::Footprint&) const;
+
     //! Run through the data
     void run ();
 
@@ -149,12 +153,48 @@ namespace dsp {
     //! Insert a dump point before the named operation
     void insert_dump_point (const std::string& transformation_name);
 
+    //! Insert Transpose operations where they reduce the cost of processing
+    void plan_order (TimeSeries::Order);
+
     //! The scratch space shared by all operations
     Reference::To<Scratch> scratch;
 
     //! The minimum number of samples required to process
     uint64_t minimum_samples;
 
+    //! Chooses the block size during the first blocks of run
+    Reference::To<BlockSizeTuner> tuner;
+
+    //! Create the tuner and its candidate block sizes
+    void prepare_tuner ();
+
+    //! Return the key under which the tuned block size is cached
+    std::string get_tuner_key () const;
+
+    //! Set the block size chosen by the tuner
+    void set_tuned_block_size ();
+
+    //! Operations that may be skipped when real-time processing falls behind
+    std::vector< Reference::To<Operation,false> > sheddable;
+
+    //! Add an operation that may be skipped when processing falls behind
+    void add_sheddable (Operation*);
+
+    //! Sheddable operations are currently being skipped
+    bool shedding;
+
+    //! Number of blocks, late blocks and blocks with operations skipped
+    uint64_t latency_nblock;
+    uint64_t latency_nlate;
+    uint64_t latency_nshed;
+
+    //! Sum and maximum of the latency of each block in seconds
+    double latency_sum;
+    double latency_max;
+
+    //! Measure the latency of the last block and start/stop shedding
+    void track_latency ();
+
     Reference::To<Memory> device_memory;
     void* gpu_stream;
     
@@ -186,6 +226,9 @@ namespace dsp {
     // Input files represent a single continuous observation
     bool force_contiguity;
 
+    //! megabytes staged by a separate reader thread for each input file
+    unsigned read_ahead;
+
     // Command line values are header params, not file names
     bool command_line_header;
 
@@ -210,6 +253,9 @@ namespace dsp {
     //! run repeatedly on the same input
     bool run_repeatedly;
 
+    //! number of blocks used to measure each candidate block size
+    unsigned autotune;
+
     //! set the cuda devices to be used
     void set_cuda_device (std::string);
     unsigned get_cuda_ndevice () const { return cuda_device.size(); }
@@ -230,9 +276,15 @@ namespace dsp {
     //! set the FFT library
     void set_fft_library (std::string);
 
+    //! target latency of real-time processing in seconds (0: no target)
+    double latency;
+
     //! use input-buffering to compensate for operation edge effects
     bool input_buffering;
 
+    //! set the storage format of input buffers (f32, f16 or bf16)
+    void set_buffer_storage (std::string);
+
     // keep input copies onto cuda device in their own stream so they
     // don't overlap (allows them to be faster and encourages staggered
     // kernel operations in other streams)
@@ -0,0 +1,160 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dspsr_SubbandShare_h
+#define __dspsr_SubbandShare_h
+
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+#include "Error.h"
+
+#include <vector>
+
+class ThreadContext;
+
+namespace dsp {
+
+  //! Shares each block of data between threads that process different sub-bands
+  /*! The operations that produce each block of data (e.g. loading,
+    unpacking and an optional coarse filterbank) are performed only
+    once, by the last of the threads to request the block.  Each thread
+    then copies its range of channels from the block using a Select
+    operation.  The next block is produced only after every thread has
+    requested it, and therefore after every thread has finished copying
+    the current block. */
+  class SubbandShare : public Reference::Able
+  {
+  public:
+
+    //! Copies a range of channels from each block of data
+    class Select;
+
+    //! Default constructor
+    SubbandShare ();
+
+    //! Destructor
+    ~SubbandShare ();
+
+    //! Add an operation performed once on each block of data
+    void add_operation (Operation*);
+
+    //! Add a thread that selects a sub-band from each block
+    void add_select (Select*);
+
+    //! Get the number of threads that share each block
+    unsigned get_nselect () const { return nselect; }
+
+    //! Prepare the shared operations (only once)
+    void prepare ();
+
+    //! Reserve the memory required by the shared operations (only once)
+    void reserve ();
+
+    //! Wait until all threads are ready, then produce the next block
+    void next_block ();
+
+    //! Called by a thread that stops before the end of the data
+    /*! The thread no longer requests blocks; every other thread throws
+      an exception from next_block instead of waiting for it. */
+    void abort (const Error& reason);
+
+    //! Add the memory required by the shared operations
+    void add_footprint (Operation::Footprint&) const;
+
+    //! Add the extensions of the shared operations
+    void add_extensions (Extensions*);
+
+  protected:
+
+    //! The operations performed on each block
+    std::vector< Reference::To<Operation> > operations;
+
+    //! Number of threads that share each block
+    unsigned nselect;
+
+    //! Number of threads waiting for the next block
+    unsigned nwaiting;
+
+    //! Number of blocks produced
+    uint64_t nblock;
+
+    //! The shared operations have been prepared
+    bool prepared;
+
+    //! The shared operations have reserved memory
+    bool reserved;
+
+    //! An exception was thrown while producing the last block
+    bool failed;
+    Error error;
+
+    //! A thread has stopped before the end of the data
+    bool aborted;
+
+    //! Protects the above attributes
+    ThreadContext* context;
+  };
+
+  class SubbandShare::Select : public Transformation<TimeSeries,TimeSeries>
+  {
+  public:
+
+    //! Default constructor
+    Select ();
+
+    //! Set the range of input channels copied to the output
+    void set_channels (unsigned first_chan, unsigned nchan);
+
+    //! Get the first input channel copied to the output
+    unsigned get_first_chan () const { return first_chan; }
+
+    //! Get the number of input channels copied to the output
+    unsigned get_nchan () const { return nchan; }
+
+    //! Set the shared source of each block (if any)
+    void set_share (SubbandShare*);
+
+    //! Release the other threads when this thread stops early
+    void abort (const Error& reason);
+
+    //! Prepare the shared operations and the output
+    void prepare ();
+
+    //! Reserve the memory required by the shared operations
+    void reserve ();
+
+    //! Add the memory required by this and the shared operations
+    void add_footprint (Footprint&) const;
+
+    //! Add the extensions of the shared operations
+    void add_extensions (Extensions*);
+
+  protected:
+
+    //! Request the next block (if shared) and copy the channels
+    void transformation ();
+
+    //! Set the output configuration
+    void prepare_output ();
+
+    //! Copy the weights of the selected channels
+    void copy_weights ();
+
+    //! The shared source of each block
+    Reference::To<SubbandShare> share;
+
+    //! The first input channel copied to the output
+    unsigned first_chan;
+
+    //! The number of input channels copied to the output
+    unsigned nchan;
+  };
+
+}
+
+#endif // !defined(__dspsr_SubbandShare_h)
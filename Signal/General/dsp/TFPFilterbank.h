@@ -15,29 +15,51 @@
 #define __TFPFilterbank_h
 
 #include "dsp/Filterbank.h"
+#include "dsp/ThreadPool.h"
 
 namespace dsp {
   
   //! Breaks a single-band TimeSeries into multiple frequency channels
-  /*! Output will be in time, frequency, polarization order */
+  /*! Output will be in time, frequency, polarization order.  Each
+    spectrum is computed in a small scratch buffer and detected directly
+    into its place in the output, so that the data are traversed only
+    once.  The FFTs may be divided among a number of threads. */
 
-  class TFPFilterbank: public Filterbank {
+  class TFPFilterbank: public Filterbank, public ThreadPool {
 
   public:
 
     //! Null constructor
     TFPFilterbank ();
 
+    //! Destructor
+    ~TFPFilterbank ();
+
+    //! Set the number of threads among which the FFTs are divided
+    void set_nthread (unsigned);
+
+    //! Sum the detected polarizations
+    void set_pscrunch (bool flag) { pscrunch = flag; }
+
   protected:
 
     //! Perform the filterbank step 
     virtual void filterbank ();
     virtual void custom_prepare ();
 
+    //! Transform and detect the parts in the range [start, end)
+    void filterbank (uint64_t start, uint64_t end, std::vector<float>& scratch);
+
   private:
 
     //! pscrunch flag
-    unsigned pscrunch;
+    bool pscrunch;
+
+    //! scratch space for each thread
+    std::vector< std::vector<float> > scratch;
+
+    //! Transform and detect the range of parts assigned to the thread
+    void run_thread (unsigned ithread);
   };
 
 }
@@ -11,6 +11,7 @@
 
 #include "dsp/Transformation.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/OrderPreference.h"
 
 namespace dsp {
 
@@ -20,11 +21,15 @@ namespace dsp {
       multiples of the decimation factor (number of samples)
   */
 
-  class TScrunch : public Transformation <TimeSeries, TimeSeries>
+  class TScrunch : public Transformation <TimeSeries, TimeSeries>,
+                   public OrderPreference
   {
 
   public:
 
+    //! Adjacent time samples are summed in a single pass in either order
+    double get_order_cost (TimeSeries::Order) const { return 1.0; }
+
     TScrunch (Behaviour place=anyplace);
     
     void set_factor ( unsigned samples );
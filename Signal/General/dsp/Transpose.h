@@ -0,0 +1,61 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_Transpose_h
+#define __dsp_Transpose_h
+
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+
+namespace dsp {
+
+  //! Converts a TimeSeries between FPT and TFP order
+  /*! The data are transposed in square tiles of time samples by
+    channels and polarizations, so that both the input and the output
+    of each tile remain in cache while the tile is copied.  Input data
+    that are already in the requested order are copied unchanged. */
+  class Transpose : public Transformation<TimeSeries,TimeSeries>
+  {
+  public:
+
+    //! Default constructor
+    Transpose ();
+
+    //! Set the order of the output data
+    void set_order (TimeSeries::Order _order) { order = _order; }
+
+    //! Get the order of the output data
+    TimeSeries::Order get_order () const { return order; }
+
+    //! Set the number of rows and columns in each tile
+    void set_tile (unsigned _tile) { tile = _tile; }
+
+    //! Get the number of rows and columns in each tile
+    unsigned get_tile () const { return tile; }
+
+  protected:
+
+    //! Transpose the input data
+    void transformation ();
+
+    //! Convert from FPT to TFP order
+    void fpt_to_tfp ();
+
+    //! Convert from TFP to FPT order
+    void tfp_to_fpt ();
+
+    //! The order of the output data
+    TimeSeries::Order order;
+
+    //! The number of rows and columns in each tile
+    unsigned tile;
+  };
+
+}
+
+#endif // !defined(__dsp_Transpose_h)
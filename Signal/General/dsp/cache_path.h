@@ -0,0 +1,27 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __dsp_cache_path_h
+#define __dsp_cache_path_h
+
+#include <string>
+
+namespace dsp {
+
+  //! Return the path to a file in the user cache directory
+  /*! The directory ($XDG_CACHE_HOME/dspsr or $HOME/.cache/dspsr) is
+    created if necessary.  Returns an empty string if neither
+    environment variable is set. */
+  std::string get_cache_path (const std::string& filename);
+
+  //! Return the name of the host, as used to key cached measurements
+  std::string get_host_name ();
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __square_law_h
+#define __square_law_h
+
+/*
+  Square-law detection of interleaved complex spectra.  When SSE3 is
+  available, four channels are detected at a time with a horizontal add
+  of the squared real and imaginary parts.
+*/
+
+#if defined(__SSE3__)
+#include <pmmintrin.h>
+
+//! Return the squared modulus of four complex values
+static inline __m128 power4 (const float* z)
+{
+  __m128 a = _mm_loadu_ps (z);
+  __m128 b = _mm_loadu_ps (z + 4);
+  return _mm_hadd_ps (_mm_mul_ps (a, a), _mm_mul_ps (b, b));
+}
+#endif
+
+//! Return the squared modulus of one complex value
+static inline float power (const float* z)
+{
+  return z[0]*z[0] + z[1]*z[1];
+}
+
+//! Detect one spectrum
+static inline void detect (float* out, const float* p0, unsigned nchan)
+{
+  unsigned ichan = 0;
+
+#if defined(__SSE3__)
+  for (; ichan + 4 <= nchan; ichan += 4)
+    _mm_storeu_ps (out + ichan, power4 (p0 + ichan*2));
+#endif
+
+  for (; ichan < nchan; ichan++)
+    out[ichan] = power (p0 + ichan*2);
+}
+
+//! Detect and sum two spectra
+static inline void detect_sum (float* out, const float* p0, const float* p1,
+			       unsigned nchan)
+{
+  unsigned ichan = 0;
+
+#if defined(__SSE3__)
+  for (; ichan + 4 <= nchan; ichan += 4)
+    _mm_storeu_ps (out + ichan, _mm_add_ps (power4 (p0 + ichan*2),
+					    power4 (p1 + ichan*2)));
+#endif
+
+  for (; ichan < nchan; ichan++)
+    out[ichan] = power (p0 + ichan*2) + power (p1 + ichan*2);
+}
+
+//! Detect one spectrum and add it to the output
+static inline void detect_add (float* out, const float* p0, unsigned nchan)
+{
+  unsigned ichan = 0;
+
+#if defined(__SSE3__)
+  for (; ichan + 4 <= nchan; ichan += 4)
+    _mm_storeu_ps (out + ichan, _mm_add_ps (_mm_loadu_ps (out + ichan),
+					    power4 (p0 + ichan*2)));
+#endif
+
+  for (; ichan < nchan; ichan++)
+    out[ichan] += power (p0 + ichan*2);
+}
+
+#endif
@@ -28,6 +28,8 @@ namespace dsp
 {
   class WeightedTimeSeries;
   class ObservationChange;
+  class MultiFold;
+  class PhaseTable;
 
   //! Fold TimeSeries data into phase-averaged profile(s)
   /*! 
@@ -49,6 +51,9 @@ namespace dsp
     //! Controls the number of phase bins returned by Fold::choose_nbin
     static bool power_of_two;
 
+    //! Compute the phase of each sample using a PhaseTable
+    static bool use_phase_table;
+
     //! Constructor
     Fold ();
     
@@ -149,6 +154,9 @@ namespace dsp
     //! Set output cerr stream
     virtual void set_cerr (std::ostream& os) const;
 
+    //! Add the profiles and the phase bin plan
+    void add_footprint (Footprint&) const;
+
     virtual Engine * get_engine() { return engine; }
 
   protected:
@@ -231,6 +239,9 @@ namespace dsp
     //! Interface to alternate processing engine (e.g. GPU)
     Reference::To<Engine> engine;
 
+    //! When set, the phase bin plan is passed to MultiFold for folding
+    MultiFold* multifold;
+
   private:
 
     // Generates folding_predictor from the given ephemeris
@@ -240,6 +251,12 @@ namespace dsp
     //! Phase model with which to fold data (PSR)
     Reference::To<const Pulsar::Predictor> folding_predictor;
 
+    //! Piecewise polynomial approximation to folding_predictor
+    Reference::To<PhaseTable> phase_table;
+
+    //! Return the phase table, or null if not used
+    PhaseTable* get_phase_table ();
+
     //! Ephemeris with which to create the phase model
     Reference::To<const Pulsar::Parameters> pulsar_ephemeris;
 
@@ -0,0 +1,257 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __FoldCheckpoint_h
+#define __FoldCheckpoint_h
+
+#include "dsp/Operation.h"
+#include "MJD.h"
+
+#include <vector>
+#include <string>
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <time.h>
+
+class ThreadContext;
+
+namespace dsp {
+
+  class Fold;
+  class PhaseSeries;
+  class TimeSeries;
+
+  //! Periodically saves the integrated profiles of one or more Fold
+  /*! Inserted into the signal path after the Fold operations, this
+    operation writes the integrated profiles to a file at regular
+    (wall-clock) intervals, together with the epoch from which the
+    input must be read in order to continue the integration.  The file
+    is first written to a temporary file that is then renamed, so that
+    an interrupted save does not corrupt the last checkpoint.
+
+    When resuming, the input is started at the saved epoch (see
+    get_resume_epoch) and the saved profiles are added to those
+    integrated from the first block of new data.
+
+    The saved epoch is the end of the folded data minus the delay
+    between the start of the unpacked data and the start of the data
+    that are folded (e.g. owing to the wrap-around of the convolution);
+    therefore, the state of InputBuffering need not be saved.
+
+    When several threads fold the data, their FoldCheckpoint instances
+    use the same Share, which saves the sum of the profiles of every
+    thread. */
+  class FoldCheckpoint : public Operation
+  {
+  public:
+
+    //! The checkpoint state shared by the threads of a reduction
+    class Share;
+
+    //! Construct with the name of the checkpoint file
+    FoldCheckpoint (const std::string& filename);
+
+    //! Destructor
+    ~FoldCheckpoint ();
+
+    //! Set the minimum wall-clock interval between checkpoints in seconds
+    void set_interval (double seconds);
+
+    //! Use the checkpoint state of another thread
+    void set_share (Share*);
+
+    //! Get the checkpoint state
+    Share* get_share () { return share; }
+
+    //! Called when this thread will fold no more data
+    void leave ();
+
+    //! Set the unpacked data from which the folded data are derived
+    void set_input (const TimeSeries* data) { input = data; }
+
+    //! Add a Fold operation to be checkpointed
+    void add_fold (Fold*);
+
+    //! Load the saved profiles, to be added to the first integrations
+    void load ();
+
+    //! Write the checkpoint file
+    void save ();
+
+    //! Return true if saved profiles are waiting to be restored
+    bool restore_pending () const;
+
+    //! Delete the checkpoint file
+    void remove ();
+
+    //! Get the epoch from which to resume; return false if no checkpoint
+    static bool get_resume_epoch (const std::string& filename, MJD& epoch);
+
+    //! Return the size of the ASCII header in bytes
+    static unsigned get_header_size () { return 4096; }
+
+    //! Resetting the operation does not affect the saved profiles
+    void reset ();
+
+    //! Does not modify the data
+    Function get_function () const { return Operation::Structural; }
+
+  protected:
+
+    //! Save the profiles when the interval has elapsed
+    void operation ();
+
+    //! The state of one integrated PhaseSeries
+    class Profile
+    {
+    public:
+      unsigned nbin;
+      unsigned nchan;
+      unsigned npol;
+      unsigned ndim;
+      unsigned hits_nchan;
+      double integration_length;
+      uint64_t ndat_total;
+      MJD start_time;
+      std::vector<float> amps;
+      std::vector<unsigned> hits;
+
+      Profile () { nbin = 0; }
+
+      //! Return true if no state has been copied or added
+      bool empty () const { return nbin == 0; }
+
+      //! Copy the state of the PhaseSeries
+      void get (const PhaseSeries*);
+
+      //! Add the state of the PhaseSeries
+      void add (const PhaseSeries*);
+
+      //! Add another state
+      void add (const Profile&);
+
+      //! Add the state to that of the PhaseSeries
+      void add_to (PhaseSeries*) const;
+
+      void write (FILE*) const;
+      void read (FILE*);
+    };
+
+    //! The checkpoint state
+    Reference::To<Share> share;
+
+    //! The unpacked data
+    Reference::To<const TimeSeries, false> input;
+
+    //! The Fold operations to be checkpointed
+    std::vector< Reference::To<Fold, false> > fold;
+
+    //! Delay between the unpacked and folded data of each Fold in seconds
+    std::vector<double> lead;
+
+    //! Number of Fold operations for which the delay has been measured
+    unsigned nlead;
+  };
+
+  /*! The first thread to find that the interval has elapsed requests a
+    checkpoint; every thread then waits after folding its current block
+    until the last thread arrives and saves the sum of all profiles.
+    Because each block is folded before its thread arrives, the folded
+    data are contiguous up to the latest end epoch of any thread. */
+  class FoldCheckpoint::Share : public Reference::Able
+  {
+  public:
+
+    //! Construct with the name of the checkpoint file
+    Share (const std::string& filename);
+
+    //! Destructor
+    ~Share ();
+
+    //! Set the minimum wall-clock interval between checkpoints in seconds
+    void set_interval (double seconds);
+
+    //! Add a thread
+    void join (FoldCheckpoint*);
+
+    //! Remove a thread, keeping the profiles that it has integrated
+    void leave (FoldCheckpoint*);
+
+    //! Called by each thread after it has folded a block
+    void arrive (FoldCheckpoint*);
+
+    //! Load the saved profiles of nfold Fold operations
+    void load (unsigned nfold);
+
+    //! Write the checkpoint file
+    void save ();
+
+    //! Return true if saved profiles are waiting to be restored
+    bool restore_pending () const;
+
+    //! Delete the checkpoint file
+    void remove ();
+
+    //! Restart the interval
+    void reset ();
+
+  protected:
+
+    //! Add saved profiles to those of a thread that has folded data
+    void restore (FoldCheckpoint*);
+
+    //! Return true if saved profiles are waiting to be restored
+    bool pending () const;
+
+    //! Write the checkpoint file (the lock is held)
+    void write ();
+
+    //! Write the checkpoint file and release the waiting threads
+    void complete ();
+
+    //! The name of the checkpoint file
+    std::string filename;
+
+    //! Minimum wall-clock interval between checkpoints
+    double interval;
+
+    //! Time of the last checkpoint
+    time_t last_save;
+
+    //! The threads that are folding data
+    std::vector<FoldCheckpoint*> threads;
+
+    //! A checkpoint has been requested
+    bool requested;
+
+    //! Number of threads waiting for the checkpoint
+    unsigned narrived;
+
+    //! Number of checkpoints completed
+    uint64_t generation;
+
+    //! Profiles integrated by threads that have left
+    std::vector<Profile> departed;
+
+    //! End epoch of the data folded by threads that have left
+    std::vector<MJD> departed_end;
+
+    //! Saved profiles waiting to be added to those of each Fold
+    std::vector<Profile> saved;
+
+    //! True for each Fold to which saved profiles have been added
+    std::vector<bool> restored;
+
+    //! Protects the above attributes
+    ThreadContext* context;
+  };
+
+}
+
+#endif // !defined(__FoldCheckpoint_h)
@@ -16,6 +16,7 @@
 
 #include "dsp/SingleThread.h"
 #include "dsp/Filterbank.h"
+#include "dsp/SubbandShare.h"
 
 namespace dsp {
 
@@ -25,6 +26,7 @@ namespace dsp {
   class Convolution;
   class Detection;
   class Fold;
+  class MultiFold;
   class Archiver;
 
   class Response;
@@ -37,8 +39,10 @@ namespace dsp {
   class SampleDelay;
   class PhaseLockedFilterbank;
 
+  class PhaseSeries;
   class PhaseSeriesUnloader;
   class SignalPath;
+  class FoldCheckpoint;
 
   class LoadToFoldN;
 
@@ -79,6 +83,9 @@ namespace dsp {
     //! Share any necessary resources with the specified thread
     void share (SingleThread*);
 
+    //! Combine the results of another thread with this
+    void combine (const SingleThread*);
+
     //! Wrap up tasks at end of data
     void end_of_data ();
 
@@ -94,6 +101,9 @@ namespace dsp {
     //! Wrap each folder in a separate thread of execution
     std::vector< Reference::To<OperationThread> > asynch_fold;
 
+    //! Fold all pulsars in a single pass through the data
+    Reference::To<MultiFold> multi_fold;
+
     //! An unloader for each pulsar to be folded
     std::vector< Reference::To<PhaseSeriesUnloader> > unloader;
 
@@ -106,6 +116,12 @@ namespace dsp {
     //! The RFI filter
     Reference::To<RFIFilter> rfi_filter;
 
+    //! Selects the sub-band processed by this thread
+    Reference::To<SubbandShare::Select> subband_select;
+
+    //! The threads that processed the other sub-bands
+    std::vector< Reference::To<const LoadToFold,false> > subband_thread;
+
   private:
 
     //! Configuration parameters
@@ -143,9 +159,24 @@ namespace dsp {
     //! Detects the phase-coherent signal
     Reference::To<Detection> detect;
 
+    //! Periodically saves the integrated profiles
+    Reference::To<FoldCheckpoint> checkpoint;
+
+    //! Prepare to save and restore the integrated profiles
+    void build_checkpoint ();
+
     //! Prepare to remove interchannel dispersion delays
     void prepare_interchan (TimeSeries*);
 
+    //! Return true if the channels of each block are divided between threads
+    bool subband_threads () const;
+
+    //! Prepare to process a sub-band of the given TimeSeries
+    TimeSeries* prepare_subband (TimeSeries*, unsigned nchan);
+
+    //! Join the sub-bands folded by each thread
+    PhaseSeries* join_subbands (unsigned ifold);
+
     //! Build to fold the given TimeSeries
     void build_fold (TimeSeries*);
     void build_fold (Reference::To<Fold>&, PhaseSeriesUnloader*);
@@ -38,6 +38,9 @@ namespace dsp {
     // set block size to result in at least this much RAM usage
     uint64_t minimum_RAM;
 
+    // set block size so that all threads use at most this much RAM
+    uint64_t total_RAM;
+
   public:
 
     //! Default constructor
@@ -59,6 +62,13 @@ namespace dsp {
     void set_minimum_RAM (uint64_t);
     uint64_t get_minimum_RAM () const { return minimum_RAM; }
 
+    // set block_size so that all threads use at most this much RAM
+    void set_total_RAM (uint64_t);
+    uint64_t get_total_RAM () const { return total_RAM; }
+
+    // divide the channels of each block between threads
+    bool subband_threads;
+
     // number of time samples used to estimate undigitized power
     unsigned excision_nsample;
     // cutoff power used for impulsive interference rejection
@@ -163,6 +173,18 @@ namespace dsp {
     // number of sub-integrations written to a single file
     unsigned subints_per_archive;
 
+    // sub-integrations appended as records to this file (see PulseStream)
+    std::string pulse_stream;
+
+    // integrated profiles periodically saved to this file (see FoldCheckpoint)
+    std::string checkpoint_filename;
+
+    // minimum wall-clock interval between checkpoints in seconds
+    double checkpoint_interval;
+
+    // resume from the checkpoint file, if it exists
+    bool resume;
+
     void single_pulse()
     {
       integration_turns = 1;
@@ -226,6 +248,9 @@ namespace dsp {
     // output archive post-processing jobs
     std::vector<std::string> jobs;
 
+    //! Seek to the checkpoint epoch when resuming
+    virtual void prepare (Input*);
+
     //! Operate in quiet mode
     virtual void set_quiet ();
 
@@ -58,6 +58,9 @@ namespace dsp {
 
     LoadToFold* at (unsigned index);
 
+    //! Share the data from which each thread selects a sub-band
+    void share_subbands ();
+
     template <class T>
     bool prepare_subint_archival ();
 
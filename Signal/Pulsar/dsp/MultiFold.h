@@ -0,0 +1,135 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __baseband_dsp_MultiFold_h
+#define __baseband_dsp_MultiFold_h
+
+#include "dsp/Operation.h"
+
+#include <vector>
+
+namespace dsp
+{
+  class Fold;
+  class TimeSeries;
+  class PhaseSeries;
+
+  //! Fold the same TimeSeries into the profiles of multiple sources
+  /*! Each Fold computes its own phase bin plan (using its own predictor,
+    sub-integration boundaries and weights) but, rather than integrating
+    the input immediately, passes the plan to this class.  Once every
+    source has been planned, the input is traversed once, in blocks of
+    time samples small enough to remain in cache, and each block is
+    integrated into the profiles of all sources before moving on.
+
+    Folds that use an alternate processing Engine, or inputs that contain
+    zeroed samples, are folded as usual by Fold.
+  */
+  class MultiFold : public Operation
+  {
+  public:
+
+    //! Default constructor
+    MultiFold ();
+
+    //! Destructor
+    ~MultiFold ();
+
+    //! Add a Fold to the set folded by this operation
+    void add_fold (Fold*);
+
+    //! Get the number of Fold instances
+    unsigned get_nfold () const { return fold.size(); }
+
+    //! Get the specified Fold
+    Fold* get_fold (unsigned ifold);
+
+    //! Set the number of bytes of input integrated into all sources at once
+    void set_block_bytes (unsigned bytes) { block_bytes = bytes; }
+    unsigned get_block_bytes () const { return block_bytes; }
+
+    //! Prepare each Fold
+    void prepare ();
+
+    //! Reserve each Fold
+    void reserve ();
+
+    //! Add extensions to each Fold
+    void add_extensions (Extensions*);
+
+    //! Combine each Fold with those of another MultiFold
+    void combine (const Operation*);
+
+    //! Reset each Fold
+    void reset ();
+
+    //! Set the scratch space of each Fold
+    void set_scratch (Scratch*);
+
+    //! Add the memory required by each Fold and its phase bin plans
+    void add_footprint (Footprint&) const;
+
+    //! Set verbosity ostream of each Fold
+    void set_cerr (std::ostream& os) const;
+
+    //! Return the total number of timesample weights encountered
+    uint64_t get_total_weights () const;
+
+    //! Return the number of invalid timesample weights encountered
+    uint64_t get_discarded_weights () const;
+
+    //! Return storage for a phase bin plan to be integrated later
+    /*! Returns null if the Fold was not added to this operation */
+    unsigned* get_binplan (const Fold*, uint64_t idat_start, uint64_t ndat);
+
+    //! Integrate any phase bin plans pending for the specified Fold
+    void flush (const Fold*);
+
+  protected:
+
+    //! Plan each Fold, then integrate the input into all sources
+    void operation ();
+
+    //! The Fold instances
+    std::vector< Reference::To<Fold> > fold;
+
+    //! Phase bin plan waiting to be integrated
+    class Plan
+    {
+    public:
+      //! The Fold that computed the plan
+      const Fold* fold;
+      //! The output into which the plan is integrated
+      PhaseSeries* result;
+      //! The phase bin of each time sample; nbin flags samples to skip
+      std::vector<unsigned> binplan;
+      //! The number of phase bins
+      unsigned nbin;
+      //! The first time sample to be integrated
+      uint64_t idat_start;
+      //! The number of time samples to be integrated
+      uint64_t ndat;
+    };
+
+    //! Pending plans (first nplan elements); storage is reused
+    std::vector<Plan> plan;
+    unsigned nplan;
+
+    //! Number of bytes of input integrated into all sources at once
+    unsigned block_bytes;
+
+    //! Integrate all pending plans
+    void integrate ();
+
+    //! Integrate time samples idat_start to idat_end of the given plan
+    void integrate (const TimeSeries* input, Plan& plan,
+                    uint64_t idat_start, uint64_t idat_end);
+  };
+}
+
+#endif
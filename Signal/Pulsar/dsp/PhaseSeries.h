@@ -16,6 +16,8 @@
 
 #include "dsp/TimeSeries.h"
 
+#include <vector>
+
 namespace Pulsar {
   class Predictor;
   class Parameters;
@@ -33,6 +35,7 @@ namespace dsp {
     friend class Fold;
     friend class CyclicFold;
     friend class PhaseLockedFilterbank;
+    friend class FoldCheckpoint;
 
   public:
 
@@ -60,6 +63,9 @@ namespace dsp {
     //! Add the given PhaseSeries to this
     void combine (const PhaseSeries*);
 
+    //! Join the given sub-bands, in order of channel, into this
+    void join (const std::vector<const PhaseSeries*>&);
+
     //! Set the reference phase (phase of bin zero)
     void set_reference_phase (double phase) { reference_phase = phase; }
     //! Get the reference phase (phase of bin zero)
@@ -0,0 +1,142 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __baseband_dsp_PhaseTable_h
+#define __baseband_dsp_PhaseTable_h
+
+#include "Pulsar/Predictor.h"
+#include "Phase.h"
+#include "MJD.h"
+
+#include <vector>
+#include <map>
+
+class ThreadContext;
+
+namespace dsp {
+
+  //! Piecewise-polynomial approximation to a Pulsar::Predictor
+  /*! Time is divided into segments of equal length, each of which is
+    approximated by a polynomial (interpolating the predictor at the
+    Chebyshev nodes) relative to the phase at the centre of the segment.
+    Segments are computed on demand and checked against the predictor;
+    if any segment exceeds the tolerance, the segment length is halved.
+
+    The phase of every time sample in a block may then be computed
+    without calling the predictor and without accumulating the rounding
+    error of a constant phase increment.
+
+    Segments are added and removed as the table is used, so each public
+    method holds a lock; a table may be shared between threads (e.g. by
+    copies of a TimeDivide). */
+  class PhaseTable : public Reference::Able {
+
+  public:
+
+    //! Default segment length in seconds
+    static double default_segment_seconds;
+
+    //! Constructor
+    PhaseTable (const Pulsar::Predictor* predictor = 0);
+
+    //! Destructor
+    ~PhaseTable ();
+
+    //! Set the predictor to be approximated
+    void set_predictor (const Pulsar::Predictor*);
+    //! Get the predictor to be approximated
+    const Pulsar::Predictor* get_predictor () const { return predictor; }
+
+    //! Set the length of each segment in seconds
+    void set_segment_seconds (double seconds);
+    double get_segment_seconds () const { return segment_seconds; }
+
+    //! Set the number of polynomial coefficients in each segment
+    void set_ncoef (unsigned ncoef);
+    unsigned get_ncoef () const { return ncoef; }
+
+    //! Set the maximum difference from the predictor in turns
+    void set_tolerance (double turns);
+    double get_tolerance () const { return tolerance; }
+
+    //! Return the phase at the given epoch
+    Phase phase (const MJD& epoch);
+
+    //! Return the spin frequency at the given epoch
+    double frequency (const MJD& epoch);
+
+    //! Return the epoch of the given phase, starting from a nearby guess
+    MJD iphase (const Phase& phase, const MJD& guess);
+
+    //! Compute the phase of ndat samples separated by interval seconds
+    /*! Phase is returned in turns relative to the integer number of
+      turns at epoch; i.e. turns[0] is the fractional phase at epoch */
+    void get_turns (double* turns, const MJD& epoch,
+                    double interval, uint64_t ndat);
+
+  protected:
+
+    class Segment
+    {
+    public:
+      //! The centre of the segment
+      MJD centre;
+      //! Half the length of the segment in seconds
+      double half;
+      //! The phase at the centre of the segment
+      Phase reference;
+      //! Polynomial in (t - centre) / half, lowest order first
+      std::vector<double> coef;
+    };
+
+    //! The predictor to be approximated
+    Reference::To<const Pulsar::Predictor> predictor;
+
+    //! The epoch from which segments are counted
+    MJD epoch;
+
+    //! Segments computed so far
+    std::map<int64_t, Segment> segments;
+
+    double segment_seconds;
+    unsigned ncoef;
+    double tolerance;
+
+    //! Protects the segments from concurrent access
+    ThreadContext* context;
+
+    //! Return the phase at the given epoch, without locking
+    Phase get_phase (const MJD& epoch);
+
+    //! Return the spin frequency at the given epoch, without locking
+    double get_frequency (const MJD& epoch);
+
+    //! Rounding error allowed at the boundaries of each segment
+    static const double span_tolerance;
+
+    //! Return the segment that contains the given epoch
+    /*! x is set to the offset of the epoch from the centre of the
+      segment, in units of half the segment length (-1 <= x <= 1) */
+    const Segment& get_segment (const MJD&, double& x);
+
+    //! Fit the segment and return the maximum difference from the predictor
+    double fit (Segment&);
+
+    //! Evaluate the polynomial of the segment at the given offset
+    static double evaluate (const Segment&, double x);
+
+  private:
+
+    //! Not copied; the table owns its lock
+    PhaseTable (const PhaseTable&);
+    PhaseTable& operator = (const PhaseTable&);
+  };
+
+}
+
+#endif
@@ -0,0 +1,179 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+#ifndef __PulseStream_h
+#define __PulseStream_h
+
+#include "dsp/PhaseSeriesUnloader.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <pthread.h>
+
+class ThreadContext;
+
+namespace dsp {
+
+  class PhaseSeries;
+
+  //! Appends sub-integrations to a single file of fixed-size records
+  /*! Intended for single-pulse mode, in which writing a separate
+    archive for each pulse is limited by file system metadata
+    operations.  The file starts with a 4096-byte ASCII header (in
+    the DADA style) that describes the layout of each record:
+
+    - int64   pulse number (or record number, if there is no predictor)
+    - int32   MJD of the start of the sub-integration (integer day)
+    - int32   reserved
+    - double  seconds since the start of the day
+    - double  folding period in seconds
+    - double  integration length in seconds
+    - float   weight of each channel
+    - float   amplitudes ordered by channel, polarization and bin
+
+    Records are gathered into chunks that are written by a background
+    thread.  Each record is also listed in an index file (the same
+    name with ".index" appended) as a pair of int64 pulse number and
+    uint64 record number, so that a reader can seek to any pulse.
+    Clones share the same file, so that each thread may unload its
+    own pulses; records may therefore appear out of order. */
+  class PulseStream : public PhaseSeriesUnloader
+  {
+
+  public:
+
+    //! Construct with the name of the output file
+    PulseStream (const std::string& filename);
+
+    //! Copy constructor shares the output file
+    PulseStream (const PulseStream&);
+
+    //! Destructor
+    ~PulseStream ();
+
+    //! Return a new PulseStream that shares the output file
+    PulseStream* clone () const;
+
+    //! Append the PhaseSeries data to the output file
+    void unload (const PhaseSeries*);
+
+    //! Wait for all records to be written
+    void finish ();
+
+    //! Set the minimum integration length required to unload data
+    void set_minimum_integration_length (double seconds);
+
+    //! Set the number of records in each chunk
+    void set_chunk_records (unsigned);
+
+    class Writer;
+
+  protected:
+
+    //! The shared output file
+    Reference::To<Writer> writer;
+
+    //! Minimum integration length required to unload data
+    double minimum_integration_length;
+
+    //! Record under construction
+    std::vector<char> record;
+  };
+
+  //! Writes chunks of PulseStream records in a background thread
+  class PulseStream::Writer : public Reference::Able
+  {
+
+  public:
+
+    //! Construct with the name of the output file
+    Writer (const std::string& filename);
+
+    //! Flush and close the output files
+    ~Writer ();
+
+    //! Set the number of records in each chunk
+    void set_chunk_records (unsigned n) { chunk_records = n; }
+
+    //! Append a record; the first record defines the header
+    /*! If pulse is negative, the record number is used */
+    void append (const std::vector<char>& record, int64_t pulse,
+                 const PhaseSeries* data);
+
+    //! Wait until all records have been written
+    void flush ();
+
+    //! Return the size of the ASCII header in bytes
+    static unsigned get_header_size () { return 4096; }
+
+  protected:
+
+    struct Chunk
+    {
+      std::vector<char> data;
+      std::vector<int64_t> index;
+    };
+
+    std::string filename;
+    FILE* data_file;
+    FILE* index_file;
+
+    //! Number of bytes in each record
+    uint64_t record_size;
+
+    //! Number of records appended
+    uint64_t nrecord;
+
+    //! Number of records in each chunk
+    unsigned chunk_records;
+
+    //! Maximum number of chunks waiting to be written
+    unsigned max_queue;
+
+    //! Chunk being filled
+    Chunk current;
+
+    //! Chunks waiting to be written
+    std::deque<Chunk> queue;
+
+    //! True while a chunk is being written
+    bool busy;
+
+    //! True when the thread should quit
+    bool quit;
+
+    //! Error message from the writing thread
+    std::string write_error;
+
+    ThreadContext* context;
+    pthread_t id;
+    bool running;
+
+    //! Open the files and write the header
+    void open (const std::vector<char>& record, const PhaseSeries* data);
+
+    //! Queue the current chunk (called with the lock held)
+    void push ();
+
+    //! Write one chunk to the files
+    void write (const Chunk&);
+
+    //! writer_thread calls thread method
+    static void* writer_thread (void*);
+
+    //! The writer thread
+    void thread ();
+  };
+
+}
+
+#endif // !defined(__PulseStream_h)
@@ -17,6 +17,7 @@
 #include "environ.h"
 #include "Pulsar/Predictor.h"
 #include "OwnStream.h"
+#include "dsp/PhaseTable.h"
 
 namespace dsp {
 
@@ -159,6 +160,9 @@ namespace dsp {
     //! The Pulsar::Predictor used to determine pulse phase
     Reference::To<const Pulsar::Predictor> poly;
 
+    //! Piecewise polynomial approximation to poly
+    Reference::To<PhaseTable> phase_table;
+
     //! Calculates the boundaries of the sub-integration containing time
     void set_boundaries (const MJD& time);
 
@@ -12,6 +12,8 @@
 #include "dsp/PearsonIV.h"
 #include "dsp/NewtonRaphson.h"
 
+#include <string>
+
 namespace dsp {
 
   class SKLimits {
@@ -22,8 +24,12 @@ namespace dsp {
 
     ~SKLimits ();
 
+    //! Set the thresholds, computing them only if they are not tabulated
     int calc_limits ();
 
+    //! Compute the thresholds without reference to the table
+    int calc_limits_exact ();
+
     double get_lower_threshold() { return lower_threshold; }
 
     double get_upper_threshold() { return upper_threshold; }
@@ -32,6 +38,15 @@ namespace dsp {
 
     void set_std_devs ( unsigned _std_devs ) { std_devs = _std_devs; }
 
+    //! Add the thresholds tabulated in filename; return false if not loaded
+    static bool load_table (const std::string& filename);
+
+    //! Write the table to filename, if it has changed since the last load/save
+    static void save_table (const std::string& filename);
+
+    //! Return the number of tabulated thresholds
+    static unsigned get_table_size ();
+
   private:
 
     //! Calculate the first four moments of the distribution and ancilliary parameters
@@ -48,6 +63,12 @@ namespace dsp {
     unsigned std_devs;
 
     unsigned verbose;
+
+    //! Return true and set the thresholds if (M,std_devs) is tabulated
+    bool lookup ();
+
+    //! Add the current thresholds to the table
+    void tabulate ();
   };
 }
 
@@ -11,6 +11,7 @@
 #include "dsp/Input.h"
 #include "dsp/BitSeries.h"
 #include "dsp/TimeSeries.h"
+#include "dsp/PhaseSeries.h"
 #include "dsp/Detection.h"
 #include "dsp/Dedispersion.h"
 #include "dsp/Response.h"
@@ -40,6 +41,25 @@ using namespace std;
     }
 }
 
+// Release the GIL while operating, so that other Python threads
+// (e.g. analysis of the previous block) can run at the same time
+%exception dsp::Operation::operate {
+    PyThreadState *_save = PyEval_SaveThread();
+    try {
+        $action
+    } catch(Error& error) {
+        PyEval_RestoreThread(_save);
+        if (error.get_code()==InvalidRange)
+            SWIG_exception(SWIG_IndexError, error.get_message().c_str());
+        else
+            SWIG_exception(SWIG_RuntimeError,error.get_message().c_str());
+    } catch(...) {
+        PyEval_RestoreThread(_save);
+        SWIG_exception(SWIG_RuntimeError,"Unknown exception");
+    }
+    PyEval_RestoreThread(_save);
+}
+
 %init %{
   import_array();
 %}
@@ -68,6 +88,28 @@ void pointer_tracker_remove(Reference::Able *ptr) {
             break;
         }
 }
+
+// Return a numpy array that points to (rather than copies) the data.
+// Strides are in bytes.  The array keeps a reference to owner (the
+// Python object that holds the data), so that the data are not freed
+// while the array exists; it is valid until the data are resized.
+PyObject *array_view(int nd, npy_intp *dims, npy_intp *strides,
+                     int type, void *ptr, PyObject *owner)
+{
+    PyObject *arr = PyArray_New(&PyArray_Type, nd, dims, type, strides,
+                                ptr, 0, NPY_WRITEABLE, NULL);
+    if (arr == NULL) return NULL;
+
+    // PyArray_SetBaseObject steals the reference
+    Py_INCREF(owner);
+    if (PyArray_SetBaseObject((PyArrayObject *)arr, owner) < 0)
+    {
+        Py_DECREF(arr);
+        return NULL;
+    }
+
+    return arr;
+}
 %}
 
 // Non-wrapped stuff to ignore
@@ -78,6 +120,9 @@ void pointer_tracker_remove(Reference::Able *ptr) {
 %ignore dsp::Convolution::Convolution(const char *, Behaviour);
 %ignore dsp::Detection::set_engine(Engine*);
 %ignore dsp::Observation::verbose_nbytes(uint64_t) const;
+%ignore dsp::PhaseSeries::operator=;
+%ignore dsp::PhaseSeries::join;
+%ignore dsp::PhaseSeries::set_hits_memory(Memory*);
 
 // Return psrchive's Estimate class as a Python tuple
 %typemap(out) Estimate<double> {
@@ -121,6 +166,7 @@ void pointer_tracker_remove(Reference::Able *ptr) {
 %include "dsp/Input.h"
 %include "dsp/BitSeries.h"
 %include "dsp/TimeSeries.h"
+%include "dsp/PhaseSeries.h"
 // Detection::Engine is screwing this up...
 //%include "dsp/Detection.h"
 %include "dsp/Dedispersion.h"
@@ -147,9 +193,120 @@ void pointer_tracker_remove(Reference::Able *ptr) {
         return (PyObject *)arr;
     }
 
+    // Return a numpy array view of all of the data, with shape
+    // (nchan, npol, ndat, ndim) in FPT order or (ndat, nchan, npol, ndim)
+    // in TFP order.  This points to the data array, not a separate copy.
+    // Called by get_view, which passes the Python object as owner.
+    PyObject *_get_view(PyObject *owner)
+    {
+        npy_intp dims[4];
+        npy_intp strides[4];
+
+        const npy_intp nchan = self->get_nchan();
+        const npy_intp npol = self->get_npol();
+        const npy_intp ndim = self->get_ndim();
+        const npy_intp nfloat = sizeof(float);
+
+        if (self->get_order() == dsp::TimeSeries::OrderTFP)
+        {
+            dims[0] = self->get_ndat();
+            dims[1] = nchan;
+            dims[2] = npol;
+            dims[3] = ndim;
+
+            strides[3] = nfloat;
+            strides[2] = ndim * nfloat;
+            strides[1] = npol * ndim * nfloat;
+            strides[0] = nchan * npol * ndim * nfloat;
+
+            return array_view(4, dims, strides, PyArray_FLOAT,
+                              self->get_dattfp(), owner);
+        }
+
+        dims[0] = nchan;
+        dims[1] = npol;
+        dims[2] = self->get_ndat();
+        dims[3] = ndim;
+
+        // each (ichan, ipol) block may be padded
+        char *base = (char *) self->get_datptr(0, 0);
+
+        strides[3] = nfloat;
+        strides[2] = ndim * nfloat;
+        strides[1] = (npol > 1) ?
+            (char *) self->get_datptr(0, 1) - base : 0;
+        strides[0] = (nchan > 1) ?
+            (char *) self->get_datptr(1, 0) - base : 0;
+
+        return array_view(4, dims, strides, PyArray_FLOAT, base, owner);
+    }
+
     // Get the frac MJD part of the start time
     double get_start_time_frac()
     {
         return self->get_start_time().fracday();
     }
+
+%pythoncode %{
+    def get_view(self):
+        """Return a numpy array view of all of the data."""
+        return self._get_view(self)
+%}
+}
+
+%extend dsp::BitSeries
+{
+    // Return a numpy array view of the raw bytes
+    // This points to the data array, not a separate copy.
+    PyObject *_get_view(PyObject *owner)
+    {
+        npy_intp dims[1];
+        dims[0] = self->get_nbytes();
+        return array_view(1, dims, NULL, PyArray_UBYTE, self->get_rawptr(),
+                          owner);
+    }
+
+%pythoncode %{
+    def get_view(self):
+        """Return a numpy array view of the raw bytes."""
+        return self._get_view(self)
+%}
 }
+
+%extend dsp::PhaseSeries
+{
+    // Return a numpy array view of the hits, with shape (hits_nchan, nbin)
+    // This points to the hits array, not a separate copy.
+    PyObject *_get_hits_view(PyObject *owner)
+    {
+        npy_intp dims[2];
+        dims[0] = self->get_hits_nchan();
+        dims[1] = self->get_nbin();
+        return array_view(2, dims, NULL, PyArray_UINT, self->get_hits(0),
+                          owner);
+    }
+
+%pythoncode %{
+    def get_hits_view(self):
+        """Return a numpy array view of the hits."""
+        return self._get_hits_view(self)
+%}
+}
+
+%pythoncode %{
+def blocks(manager, operations=[]):
+    """Process the input block-by-block, yielding after each block.
+
+    manager is a configured IOManager and operations is the list of
+    Operations performed, in order, on each block that it loads.  The
+    same containers are re-used for every block, so a view returned by
+    get_view may be created once and read after each block, provided
+    that the block size does not change.
+    """
+    input = manager.get_input()
+    while not input.eod():
+        manager.operate()
+        for operation in operations:
+            operation.operate()
+        yield manager
+%}